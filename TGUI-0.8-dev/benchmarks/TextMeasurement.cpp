@@ -0,0 +1,138 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/TGUI.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+// Compares the measurement of ASCII text glyph by glyph, the way the text was measured before the ASCII tables existed,
+// with the table based measurement that Text::recalculateSize and Text::wordWrap use.
+//
+// Usage: tgui-benchmark-text-measurement [repetitions]
+
+namespace
+{
+    const unsigned int TextSize = 18;
+
+    // Measures the text with Font::getGlyph and Font::getKerning for every character
+    float measurePerGlyph(const sf::String& text, const tgui::Font& font, bool bold)
+    {
+        float width = 0;
+        std::uint32_t prevChar = 0;
+        for (const std::uint32_t curChar : text)
+        {
+            width += font.getGlyph(curChar, TextSize, bold).advance + font.getKerning(prevChar, curChar, TextSize);
+            prevChar = curChar;
+        }
+
+        return width;
+    }
+
+    // Measures the text with the ASCII tables of the font
+    float measureWithTables(const sf::String& text, const tgui::Font& font, bool bold)
+    {
+        const float* advances = font.getAsciiAdvances(TextSize, bold);
+        const float* kernings = font.getAsciiKernings(TextSize);
+
+        float width = 0;
+        tgui::Text::measureAsciiRun(text.getData(), text.getSize(), 0, advances, kernings, std::numeric_limits<float>::infinity(), width);
+        return width;
+    }
+
+    // Random words of lowercase letters with some capitals and punctuation, like the messages in a chat
+    std::vector<sf::String> createLines(std::size_t lineCount, std::size_t lineLength)
+    {
+        std::mt19937 generator{1234};
+        std::uniform_int_distribution<int> letter{'a', 'z'};
+        std::uniform_int_distribution<int> kind{0, 19};
+
+        std::vector<sf::String> lines;
+        for (std::size_t i = 0; i < lineCount; ++i)
+        {
+            std::string line;
+            while (line.size() < lineLength)
+            {
+                const int k = kind(generator);
+                if (k < 3)
+                    line += ' ';
+                else if (k == 3)
+                    line += static_cast<char>(letter(generator) - 'a' + 'A');
+                else if (k == 4)
+                    line += ",.!?"[letter(generator) % 4];
+                else
+                    line += static_cast<char>(letter(generator));
+            }
+
+            lines.push_back(line);
+        }
+
+        return lines;
+    }
+
+    template <typename MeasureFunc>
+    void runBenchmark(const char* name, const std::vector<sf::String>& lines, const tgui::Font& font, unsigned int repetitions,
+                      const MeasureFunc& measure)
+    {
+        // The first measurement fills the glyph cache and the tables of the font, which shouldn't be part of the timing
+        float totalWidth = 0;
+        for (const auto& line : lines)
+            totalWidth += measure(line, font, false);
+
+        const auto start = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < repetitions; ++i)
+        {
+            for (const auto& line : lines)
+                totalWidth += measure(line, font, false);
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        std::cout << name << ": " << std::chrono::duration<double, std::milli>(end - start).count() << " ms"
+                  << " (total width " << totalWidth / (repetitions + 1) << ")" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const unsigned int repetitions = (argc > 1) ? static_cast<unsigned int>(std::atoi(argv[1])) : 100;
+    const tgui::Font font = tgui::getGlobalFont();
+
+    for (const std::size_t lineLength : {16, 80, 1000})
+    {
+        const auto lines = createLines(100000 / lineLength, lineLength);
+        std::cout << lines.size() << " lines of " << lineLength << " characters, " << repetitions << " repetitions" << std::endl;
+
+        runBenchmark("  per glyph      ", lines, font, repetitions, measurePerGlyph);
+        runBenchmark("  measureAsciiRun", lines, font, repetitions, measureWithTables);
+    }
+
+    return 0;
+}
@@ -28,15 +28,23 @@
 
 #include <TGUI/Global.hpp>
 #include <TGUI/Vector2f.hpp>
+#include <TGUI/FloatRect.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/View.hpp>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
+    /// @brief Limits the area of the target in which is drawn, for as long as the object exists
+    ///
+    /// The clipping areas are kept on a stack and each new area is intersected with the one below it when it is created.
+    /// The view of the target isn't changed, the primitives that are drawn via PrimitiveBatch are cut off on the cpu so
+    /// that clipped widgets can still share draw calls. Only objects that can't be clipped that way (e.g. texts) and
+    /// widgets that draw directly to the target are drawn with a view that shows nothing outside the clipping area.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API Clipping
     {
     public:
@@ -61,6 +69,21 @@ namespace tgui
         ~Clipping();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns the area of the target outside which nothing may be drawn, in the coordinates of the gui view.
+        // A nullptr is returned when nothing is being clipped on the target.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const FloatRect* getClipRect(const sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns a view that only shows the given clipping area of the gui view
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static sf::View getClippingView(const FloatRect& clipRect);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         // Sets the view used by the gui, which the calculations have to take into account when changing the view for clipping
@@ -68,12 +91,23 @@ namespace tgui
         static void setGuiView(const sf::View& view);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns the view that was last passed to setGuiView
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const sf::View& getGuiView();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        sf::RenderTarget& m_target;
-        sf::View m_oldView;
+        struct ClipArea
+        {
+            const sf::RenderTarget* target;
+            FloatRect rect;
+        };
 
+        static std::vector<ClipArea> m_clipAreas;
         static sf::View m_originalView;
     };
 
@@ -28,8 +28,11 @@
 
 
 #include <list>
+#include <memory>
+#include <functional>
 
 #include <TGUI/Widget.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -280,6 +283,33 @@ namespace tgui
         void moveWidgetToBack(const Widget::Ptr& widget);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the contents of the container are drawn to a texture that is reused until they change
+        ///
+        /// @param cached  Should the background and child widgets be rendered to a texture?
+        ///
+        /// When caching is enabled, the background and the child widgets are rendered to an sf::RenderTexture once. Until
+        /// one of the child widgets changes, only that texture has to be drawn, which saves a lot of draw calls for
+        /// containers with many widgets that rarely change.
+        ///
+        /// The contents are still drawn directly when the texture wouldn't look the same, e.g. when the gui view is scaled,
+        /// when the opacity of the container is lower than 1 or when the background of the container isn't fully opaque.
+        ///
+        /// Caching is only supported by Panel and ChildWindow, it is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRenderCaching(bool cached);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the contents of the container are drawn to a texture that is reused until they change
+        ///
+        /// @return Are the background and child widgets rendered to a texture?
+        ///
+        /// @see setRenderCaching
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getRenderCaching() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focuses the next widget in this container
         /// @return Whether a new widget was focused
@@ -412,6 +442,15 @@ namespace tgui
         virtual void drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states = sf::RenderStates::Default) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the contents of the container from the render cache. The drawContents function is only called to fill the
+        // cache again when the container was invalidated since the last time. Returns false without drawing anything when
+        // caching is disabled or isn't possible, in which case the contents have to be drawn directly.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool drawCachedContents(sf::RenderTarget& target, const sf::RenderStates& states, Vector2f size,
+                                const std::function<void(sf::RenderTarget&, const sf::RenderStates&)>& drawContents) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Find out what the index of the focused widget is. Returns 0 when no widget is focused and index+1 otherwise.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -439,6 +478,10 @@ namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        // Texture to which the contents are rendered when caching is enabled
+        bool m_renderCaching = false;
+        mutable std::unique_ptr<sf::RenderTexture> m_renderCache;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -28,6 +28,8 @@
 
 #include <TGUI/Config.hpp>
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/System/String.hpp>
+#include <SFML/System/Vector2.hpp>
 #include <cstdint>
 #include <string>
 #include <cstddef>
@@ -183,6 +185,9 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Retrieve a glyph of the font
         ///
+        /// Glyphs without outline are cached per character size and boldness, so that retrieving them again doesn't have to
+        /// search the glyph tables of the SFML font. The cache assumes that the sf::Font is not reloaded while in use.
+        ///
         /// If the font is a bitmap font, not all character sizes might be available. If the glyph is not available at the
         /// requested size, an empty glyph is returned.
         ///
@@ -202,6 +207,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the kerning offset of two glyphs
         ///
+        /// The kerning of every pair of characters is cached per character size.
+        ///
         /// The kerning is an extra offset (negative) to apply between two glyphs when rendering them, to make the pair look
         /// more "natural". For example, the pair "AV" have a special kerning to make them closer than other characters.
         /// Most of the glyphs pairs have a kerning offset of zero, though.
@@ -219,6 +226,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the line spacing
         ///
+        /// The line spacing is cached per character size.
+        ///
         /// Line spacing is the vertical offset to apply between two consecutive lines of text.
         ///
         /// @param characterSize Size of the characters
@@ -229,11 +238,93 @@ namespace tgui
         float getLineSpacing(unsigned int characterSize) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the texture containing the loaded glyphs of a certain size
+        ///
+        /// The texture may grow when new glyphs are loaded, but the texture rectangles of glyphs that were already loaded
+        /// remain valid. This function may only be called when a font is set.
+        ///
+        /// @param characterSize Size of the characters
+        ///
+        /// @return Texture containing the glyphs of the requested size
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Texture& getTexture(unsigned int characterSize) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the advances of the printable ASCII characters, used to quickly measure ASCII text
+        ///
+        /// @param characterSize Size of the characters
+        /// @param bold          Whether the advances of the bold glyphs are requested
+        ///
+        /// @return Table of 128 advances indexed by the character, the advances of non-printable characters are 0
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const float* getAsciiAdvances(unsigned int characterSize, bool bold) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the kerning between the printable ASCII characters, used to quickly measure ASCII text
+        ///
+        /// @param characterSize Size of the characters
+        ///
+        /// @return Table of 128x128 kerning offsets indexed by (first * 128 + second),
+        ///         or nullptr when the font has no kerning between any of the printable ASCII characters
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const float* getAsciiKernings(unsigned int characterSize) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Looks up the size of a text that was measured before with this font
+        ///
+        /// @param text          The text that was measured
+        /// @param characterSize Size of the characters
+        /// @param style         Style of the text
+        /// @param size          Set to the size of the text when it was found
+        ///
+        /// @return Whether the size of the text was found
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool findCachedTextSize(const sf::String& text, unsigned int characterSize, std::uint32_t style, sf::Vector2f& size) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Stores the size of a text that was measured with this font, so that it doesn't need to be measured again
+        ///
+        /// @param text          The text that was measured
+        /// @param characterSize Size of the characters
+        /// @param style         Style of the text
+        /// @param size          The measured size of the text
+        ///
+        /// Only a limited amount of sizes is kept, the size that was used the longest time ago is removed when the cache is full.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void cacheTextSize(const sf::String& text, unsigned int characterSize, std::uint32_t style, sf::Vector2f size) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct MetricsCache;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the metrics cache of the font, all Font objects that share the same SFML font also share the cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<MetricsCache> getMetricsCache(const std::shared_ptr<sf::Font>& font);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         std::shared_ptr<sf::Font> m_font;
         std::string m_id;
+        std::shared_ptr<MetricsCache> m_metricsCache;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Container.hpp>
+#include <TGUI/PrimitiveBatch.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <queue>
 
@@ -170,6 +171,38 @@ namespace tgui
         void draw();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether something changed in the gui since the last time it was drawn
+        ///
+        /// The time is updated by this function, so that running animations and the blinking caret are taken into account.
+        ///
+        /// When this function returns false, drawing the gui again would give exactly the same result. Applications that only
+        /// show the gui can then skip drawing and displaying the window completely and wait for the next event instead.
+        ///
+        /// @return Does the gui have to be drawn again?
+        ///
+        /// @see drawIfDirty
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool needsRedraw();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the widgets, but only when something changed since the last time that the gui was drawn
+        ///
+        /// @return Was the gui drawn? When this function returns false, the window doesn't have to be displayed again.
+        ///
+        /// Usage example:
+        /// @code
+        /// window.clear();
+        /// if (gui.drawIfDirty())
+        ///     window.display();
+        /// @endcode
+        ///
+        /// @see needsRedraw
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool drawIfDirty();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the internal container of the Gui
         ///
@@ -413,6 +446,12 @@ namespace tgui
         void init();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the time based on the internal clock, as long as the window is focused
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTime();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -431,6 +470,9 @@ namespace tgui
         // Internal container to store all widgets
         GuiContainer::Ptr m_container = std::make_shared<GuiContainer>();
 
+        // Collects the primitives of the widgets while drawing, so that they can be drawn with less draw calls
+        PrimitiveBatch m_primitiveBatch;
+
         Widget::Ptr m_visibleToolTip = nullptr;
         sf::Time m_tooltipTime;
         bool m_tooltipPossible = false;
@@ -0,0 +1,205 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_INPUT_VALIDATOR_HPP
+#define TGUI_INPUT_VALIDATOR_HPP
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/String.hpp>
+#include <cstdint>
+#include <functional>
+#include <regex>
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Base class for objects that decide which text can be typed in an edit box
+    ///
+    /// An edit box checks the whole text with isValid when the text is set, and only the typed character with
+    /// isValidInsertion when the user types. Removing characters from a valid text is never checked.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API InputValidator
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Virtual destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual ~InputValidator() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether a text is accepted
+        ///
+        /// @param text  The text to check
+        ///
+        /// @return Whether the text is valid
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isValid(const sf::String& text) const = 0;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether a text is still accepted after a character is typed in it
+        ///
+        /// @param text        The current text, which is valid
+        /// @param pos         Position at which the character is inserted
+        /// @param erasedCount Amount of characters starting at pos that are replaced by the character (the selected text)
+        /// @param character   The character that is inserted
+        ///
+        /// @return Whether the text would be valid after inserting the character
+        ///
+        /// The default implementation builds the new text and passes it to isValid. The validators that are provided by
+        /// TGUI only look at the inserted character and the characters that surround it.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isValidInsertion(const sf::String& text, std::size_t pos, std::size_t erasedCount, std::uint32_t character) const;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Accepts integers with an optional sign in front of them, or only the digits of positive integers
+    ///
+    /// Incomplete numbers (an empty text or only a sign) are accepted, so that the user can type them.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API IntValidator : public InputValidator
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param allowSign  Can there be a + or - sign in front of the number?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit IntValidator(bool allowSign = true);
+
+        bool isValid(const sf::String& text) const override;
+        bool isValidInsertion(const sf::String& text, std::size_t pos, std::size_t erasedCount, std::uint32_t character) const override;
+
+    private:
+        bool m_allowSign;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Accepts decimal numbers with an optional sign in front of them
+    ///
+    /// Incomplete numbers (e.g. an empty text, only a sign or only a dot) are accepted, so that the user can type them.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API FloatValidator : public InputValidator
+    {
+    public:
+
+        bool isValid(const sf::String& text) const override;
+        bool isValidInsertion(const sf::String& text, std::size_t pos, std::size_t erasedCount, std::uint32_t character) const override;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Accepts any text that doesn't contain more than a given amount of characters
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API MaxLengthValidator : public InputValidator
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param maxLength  Maximum amount of characters in the text
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit MaxLengthValidator(std::size_t maxLength);
+
+        bool isValid(const sf::String& text) const override;
+        bool isValidInsertion(const sf::String& text, std::size_t pos, std::size_t erasedCount, std::uint32_t character) const override;
+
+    private:
+        std::size_t m_maxLength;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Accepts any text that only consists of characters for which a function returns true
+    ///
+    /// @code
+    /// editBox->setInputValidator(std::make_shared<tgui::CharacterClassValidator>([](std::uint32_t c){ return (c < 128) && std::isalnum(c); }));
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API CharacterClassValidator : public InputValidator
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param isAllowed  Function that returns whether a character may be part of the text
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit CharacterClassValidator(std::function<bool(std::uint32_t)> isAllowed);
+
+        bool isValid(const sf::String& text) const override;
+        bool isValidInsertion(const sf::String& text, std::size_t pos, std::size_t erasedCount, std::uint32_t character) const override;
+
+    private:
+        std::function<bool(std::uint32_t)> m_isAllowed;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Accepts any text that matches a regular expression
+    ///
+    /// The whole text has to be matched again each time a character is typed, so the other validators should be preferred
+    /// when they can describe the input. Unicode is not supported, texts containing characters that don't fit in the ANSI
+    /// character set are rejected.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RegexValidator : public InputValidator
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param regex  Valid regular expression for std::regex that has to match the whole text
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit RegexValidator(const std::string& regex);
+
+        bool isValid(const sf::String& text) const override;
+
+    private:
+        std::regex m_regex;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_INPUT_VALIDATOR_HPP
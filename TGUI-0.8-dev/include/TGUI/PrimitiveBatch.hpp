@@ -0,0 +1,151 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_PRIMITIVE_BATCH_HPP
+#define TGUI_PRIMITIVE_BATCH_HPP
+
+#include <TGUI/Global.hpp>
+#include <TGUI/Vector2f.hpp>
+#include <TGUI/FloatRect.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Collects the primitives that are drawn during a frame, so that they can be drawn with less draw calls
+    ///
+    /// While the gui is being drawn, triangles that are drawn with the same texture, blend mode and view are added to a
+    /// single vertex buffer instead of being drawn one by one. The buffer is drawn when one of these states changes, when
+    /// something else has to be drawn on top of it or when the gui is done drawing.
+    ///
+    /// Widgets draw through the static draw functions of this class instead of directly to the render target, so that
+    /// everything still ends up on the screen in the order in which it was drawn. Containers call flush before drawing a
+    /// widget that may draw directly to the target (see Widget::draw).
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API PrimitiveBatch
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Starts collecting the primitives that are drawn to a target
+        ///
+        /// @param target  Render target to which the gui is drawing
+        ///
+        /// Until end is called, the static draw functions will collect the triangles that they draw to this target.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void begin(sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Draws all primitives that were collected and stops collecting them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void end();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws primitives defined by an array of vertices
+        ///
+        /// @param target       Render target to draw to
+        /// @param vertices     Pointer to the vertices
+        /// @param vertexCount  Number of vertices in the array
+        /// @param type         Type of primitives to draw
+        /// @param states       Render states to use for drawing
+        ///
+        /// Triangles and triangle strips that are drawn without a shader to the target of the gui are added to the batch,
+        /// after cutting off the parts that lie outside the clipping area. Everything else is drawn immediately, after the
+        /// primitives that were collected before.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void draw(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type,
+                         const sf::RenderStates& states = sf::RenderStates::Default);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a drawable object, after drawing the primitives that were collected before
+        ///
+        /// @param target    Render target to draw to
+        /// @param drawable  Object to draw
+        /// @param states    Render states to use for drawing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states = sf::RenderStates::Default);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the primitives that were collected for a target
+        ///
+        /// @param target  Render target to which the primitives were drawn
+        ///
+        /// This has to be called before drawing directly to the target while the gui is being drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void flush(sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a triangle of which the positions were already transformed, clipped to the given area when there is one
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addTriangle(const sf::Vertex& vertex1, const sf::Vertex& vertex2, const sf::Vertex& vertex3, const FloatRect* clipRect);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the vertices that were collected and empties the buffer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawCollectedVertices();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        sf::RenderTarget* m_target = nullptr;
+
+        // Triangles with positions that were already transformed, which all share the states below
+        std::vector<sf::Vertex> m_vertices;
+        const sf::Texture* m_texture = nullptr;
+        sf::BlendMode m_blendMode;
+        sf::View m_view;
+
+        // Buffers for cutting triangles that intersect with the border of the clipping area
+        std::vector<sf::Vertex> m_polygon;
+        std::vector<sf::Vertex> m_clippedPolygon;
+
+        // The batch of the gui that is currently being drawn
+        static PrimitiveBatch* m_activeBatch;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PRIMITIVE_BATCH_HPP
@@ -163,6 +163,19 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether any signal handlers are connected to this signal
+        ///
+        /// @return True when emitting the signal would call at least one signal handler
+        ///
+        /// This can be used to avoid preparing the parameters of the signal when nobody is listening.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool hasHandlers() const
+        {
+            return !m_handlers.empty();
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the name given to the signal
         ///
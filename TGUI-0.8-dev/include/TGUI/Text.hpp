@@ -32,6 +32,8 @@
 #include <TGUI/TextStyle.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Transformable.hpp>
+#include <cstdint>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -43,6 +45,27 @@ namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Line of a word-wrapped text, as a range of characters in the original string
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct WrappedLine
+        {
+            std::size_t begin; ///< Index of the first character of the line
+            std::size_t end;   ///< Index past the last character of the line, the newline that ends the line is not included
+            float width;       ///< Width of the characters in the line
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief How often the size of a text was found in the cache of measured texts
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct SizeCacheStatistics
+        {
+            std::size_t hits;   ///< Amount of times that a text didn't have to be measured because its size was cached
+            std::size_t misses; ///< Amount of times that a text was measured because its size wasn't cached
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the distance that text should be placed from the side of a widget as padding.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -106,6 +129,117 @@ namespace tgui
         static sf::String wordWrap(float maxWidth, const sf::String& text, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace = true);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// Finds where the lines have to be split so that the width of the text does not exceed maxWidth.
+        ///
+        /// @param lines            Vector that is filled with the lines, its previous contents are removed
+        /// @param maxWidth         Maximum width of the text
+        /// @param text             The text to wrap
+        /// @param font             Font of the text
+        /// @param textSize         The text size
+        /// @param bold             Should the text be bold?
+        /// @param dropLeadingSpace Should a single space at the beginning of a line be removed?
+        ///
+        /// The lines are the same as the ones that would be found by splitting the result of the other wordWrap function on
+        /// its newline characters, but the text isn't copied. A space that is dropped from the start of a line is part of
+        /// the previous line. Reusing the same vector between calls avoids memory allocations.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void wordWrap(std::vector<WrappedLine>& lines, float maxWidth, const sf::String& text, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// Finds the end of a single line of a word-wrapped text.
+        ///
+        /// @param maxWidth         Maximum width of the text
+        /// @param text             The text to wrap
+        /// @param begin            Index of the first character of the line
+        /// @param font             Font of the text
+        /// @param textSize         The text size
+        /// @param bold             Should the text be bold?
+        /// @param dropLeadingSpace Should a single space at the beginning of a line be removed?
+        ///
+        /// @return The line starting at begin. The next line starts at the end of this line, or one character later when
+        ///         the line was ended by a newline character.
+        ///
+        /// Where a line ends only depends on the text starting at begin, so this can be used to wrap only part of a text again
+        /// after it was changed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static WrappedLine wordWrapLine(float maxWidth, const sf::String& text, std::size_t begin, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// Calculates the horizontal position of every character in a single line of text.
+        ///
+        /// @param positions Vector that is filled with the positions, its previous contents are removed
+        /// @param text      The text to measure, newline characters are treated as characters without a width
+        /// @param font      Font of the text
+        /// @param textSize  The text size
+        /// @param bold      Should the text be bold?
+        ///
+        /// After the call the vector contains one element more than there are characters in the text. Element i contains the
+        /// same value as findCharacterPos(i).x would return for a text object with the given properties, so the last element
+        /// is the width of the text. Reusing the same vector between calls avoids memory allocations.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void calculateCharacterPositions(std::vector<float>& positions, const sf::String& text, Font font, unsigned int textSize, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// Finds where a caret should be placed to be closest to a horizontal position.
+        ///
+        /// @param positions The character positions that were calculated with calculateCharacterPositions
+        /// @param x         Horizontal position relative to the start of the text
+        ///
+        /// @return Index of the character in front of which the caret should be placed, or the amount of characters when
+        ///         the caret should be placed behind the last character
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t findCharacterIndex(const std::vector<float>& positions, float x);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Adds the widths of the printable ASCII characters at the start of a text for as long as the total width
+        ///        stays within maxWidth
+        ///
+        /// @param text      Characters to measure
+        /// @param count     Amount of characters in text
+        /// @param prevChar  Character in front of the text (0 when there is none), which has to be below 128
+        /// @param advances  Table returned by Font::getAsciiAdvances
+        /// @param kernings  Table returned by Font::getAsciiKernings
+        /// @param maxWidth  Width that the total width may not exceed
+        /// @param width     Width to which the widths of the characters are added
+        ///
+        /// Runs of characters are measured several at a time when the library is built with SSE2 or AVX2 enabled.
+        ///
+        /// @return Amount of characters that were added to the width
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t measureAsciiRun(const sf::Uint32* text, std::size_t count, std::uint32_t prevChar,
+                                           const float* advances, const float* kernings, float maxWidth, float& width);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how often the size of a text could be taken from the cache instead of measuring the text
+        ///
+        /// The size of a text is calculated each time its string, character size, style or font is changed. The sizes of
+        /// short texts are cached per font, so that texts that are shown many times (e.g. names, captions and menu items)
+        /// are only measured once. Long texts are always measured and are not counted.
+        ///
+        /// @return The amount of hits and misses since the start of the program or the last call to resetSizeCacheStatistics
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static SizeCacheStatistics getSizeCacheStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the amount of hits and misses of the cache of measured texts back to 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void resetSizeCacheStatistics();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -0,0 +1,250 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_TEXT_ROPE_HPP
+#define TGUI_TEXT_ROPE_HPP
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/String.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Text in which characters can be inserted and erased at any position in logarithmic time
+    ///
+    /// The characters are stored in chunks of limited size which are kept in a balanced tree. Every node of the tree knows how
+    /// many characters and newlines its subtree contains, so that both a character and the start of a line can be found
+    /// without going over the whole text.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TextRope
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor that creates an empty text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextRope();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor that stores a copy of the given text
+        ///
+        /// @param text  Initial text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextRope(const sf::String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextRope(const TextRope& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextRope(TextRope&& other) noexcept;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~TextRope();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextRope& operator=(const TextRope& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextRope& operator=(TextRope&& other) noexcept;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of characters in the text
+        ///
+        /// @return Size of the text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the text is empty
+        ///
+        /// @return True when the text contains no characters
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isEmpty() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the character at the given position
+        ///
+        /// @param index  Position of the character, which has to be smaller than the size of the text
+        ///
+        /// @return The UTF-32 character
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::uint32_t operator[](std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Inserts characters at the given position
+        ///
+        /// @param position  Position at which the characters are inserted, which may not be larger than the size of the text
+        /// @param text      Characters to insert
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insert(std::size_t position, const sf::String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Inserts a single character at the given position
+        ///
+        /// @param position   Position at which the character is inserted, which may not be larger than the size of the text
+        /// @param character  UTF-32 character to insert
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insert(std::size_t position, std::uint32_t character);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Erases characters from the text
+        ///
+        /// @param position  Position of the first character to erase
+        /// @param count     Amount of characters to erase, characters past the end of the text are ignored
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void erase(std::size_t position, std::size_t count = sf::String::InvalidPos);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns part of the text
+        ///
+        /// @param position  Position of the first character
+        /// @param length    Amount of characters, characters past the end of the text are ignored
+        ///
+        /// @return Copy of the requested characters
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String substring(std::size_t position, std::size_t length = sf::String::InvalidPos) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a copy of the whole text
+        ///
+        /// @return The text as a string
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String toString() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of lines in the text, which is one more than the amount of newline characters
+        ///
+        /// @return Amount of lines
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLineCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns on which line a position is located
+        ///
+        /// @param position  Position in the text
+        ///
+        /// @return Amount of newline characters in front of the position
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLineIndex(std::size_t position) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the position at which a line starts
+        ///
+        /// @param line  Index of the line
+        ///
+        /// @return Position directly behind the newline in front of the line, or the size of the text when there is no such line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLineStart(std::size_t line) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct Node;
+
+        // Recalculates the totals of a node after its chunk or children changed
+        static void updateNode(Node& node);
+
+        // Splits the tree so that the first part contains the characters in front of the position
+        static void split(std::unique_ptr<Node> node, std::size_t position, std::unique_ptr<Node>& left, std::unique_ptr<Node>& right);
+
+        // Joins two trees, all characters of the left tree come in front of those of the right tree
+        static std::unique_ptr<Node> merge(std::unique_ptr<Node> left, std::unique_ptr<Node> right);
+
+        // Joins two trees like merge, but small chunks around the place where the trees meet are combined with their neighbours
+        static std::unique_ptr<Node> concatenate(std::unique_ptr<Node> left, std::unique_ptr<Node> right);
+
+        // Moves the first chunk of the right tree to the back of the last chunk of the left tree when they fit in one chunk
+        static void joinChunksAtSeam(std::unique_ptr<Node>& left, std::unique_ptr<Node>& right);
+
+        // Removes the first or last node from a tree and returns it
+        static std::unique_ptr<Node> takeFirstNode(std::unique_ptr<Node>& node);
+        static std::unique_ptr<Node> takeLastNode(std::unique_ptr<Node>& node);
+
+        // Adds the characters of a chunk to the back of the last chunk of a tree
+        static void appendToLastChunk(Node& node, const Node& source);
+
+        // Creates a deep copy of a tree
+        static std::unique_ptr<Node> clone(const Node* node);
+
+        // Adds the characters between begin and end of a tree to the output
+        static void appendRange(const Node* node, std::size_t begin, std::size_t end, std::vector<std::uint32_t>& output);
+
+        // Builds a tree containing the given characters
+        std::unique_ptr<Node> build(const std::uint32_t* characters, std::size_t count);
+
+        // Inserts characters in the text
+        void insert(std::size_t position, const std::uint32_t* characters, std::size_t count);
+
+        // Returns a pseudo-random priority for a new node, which keeps the tree balanced
+        std::uint32_t generatePriority();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::unique_ptr<Node> m_root;
+        std::uint32_t m_randomState = 2463534242u;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXT_ROPE_HPP
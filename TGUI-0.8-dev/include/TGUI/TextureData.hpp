@@ -37,20 +37,26 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    struct TextureDataHolder;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     // Used by the Texture class
     struct TGUI_API TextureData
     {
-        std::unique_ptr<sf::Image> image;
-        sf::Texture texture;
+        std::unique_ptr<sf::Image> image; // Freed by the TextureManager after loading, unless it was asked to keep the images
+        std::shared_ptr<sf::Texture> texture; // May be shared with other images when the TextureManager packs them in an atlas
+        sf::IntRect textureRect; // Part of the texture that contains the image
         sf::IntRect rect;
+        std::vector<bool> opacityMask; // One bit per pixel of the loaded part, row by row, set when the pixel isn't fully transparent
         sf::Shader* shader = nullptr;
+        TextureDataHolder* holder = nullptr; // Entry in the TextureManager, if the texture was loaded by it
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -61,6 +67,7 @@ namespace tgui
         std::shared_ptr<TextureData> data;
         std::string  filename;
         unsigned int users = 0;
+        bool separate = false; // The texture of the data only contains this image, even when the atlas mode is enabled
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -29,9 +29,10 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/TextureData.hpp>
+#include <unordered_map>
 #include <memory>
-#include <list>
-#include <map>
+#include <vector>
+#include <string>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -79,10 +80,130 @@ namespace tgui
         static void removeTexture(std::shared_ptr<TextureData> textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns texture data with the same image as the given data, but in a texture that isn't shared
+        ///
+        /// @param texture      The texture object that will use the returned texture data
+        /// @param textureData  Texture data of which the texture may contain other images as well
+        ///
+        /// The filter of the returned texture can be changed without affecting other images. Texture objects that ask for a
+        /// separate texture for the same part of the same image will share the returned data.
+        ///
+        /// @return Texture data with a texture of its own, or nullptr when the texture could not be created
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<TextureData> getSeparateTexture(Texture& texture, std::shared_ptr<TextureData> textureData);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether images share their textures with other images
+        ///
+        /// @param enabled  Should images that are loaded afterwards be placed in shared textures?
+        ///
+        /// When the atlas mode is enabled, all parts that are loaded from the same image are taken from a single texture and
+        /// small images are packed together in larger atlas textures. Widgets of which the images end up in the same texture
+        /// can then be drawn together, without switching textures in between.
+        ///
+        /// Images on which the smooth filter is enabled still get a texture of their own.
+        ///
+        /// The atlas mode is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether images share their textures with other images
+        ///
+        /// @return Is the atlas mode enabled?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAtlasEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the loaded images are kept in memory after they were uploaded to the gpu
+        ///
+        /// @param keep  Should the images that are loaded afterwards be kept in memory?
+        ///
+        /// Finding out which pixels of a texture are transparent only requires a mask with one bit per pixel, so by default
+        /// the image is freed once its texture has been created. Keep the images when you need to access them via the
+        /// texture data.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setKeepImagesInMemory(bool keep);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the loaded images are kept in memory after they were uploaded to the gpu
+        ///
+        /// @return Are images kept in memory?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool getKeepImagesInMemory();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Places the image of the texture data in a shared texture and points the texture data to the requested part of it.
+        // Returns false when the image couldn't be placed in a shared texture.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool loadSharedTexture(TextureData& data, const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies a small image into one of the atlas pages and returns the page, rect is set to where the image was placed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<sf::Texture> addToAtlas(const sf::Image& image, sf::IntRect& rect);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        static std::map<std::string, std::list<TextureDataHolder>> m_imageMap;
+        // Identifies a loaded part of an image
+        struct ImageKey
+        {
+            std::string filename;
+            sf::IntRect rect;
+            bool separate = false;
+
+            bool operator==(const ImageKey& other) const
+            {
+                return (filename == other.filename) && (rect == other.rect) && (separate == other.separate);
+            }
+        };
+
+        struct ImageKeyHash
+        {
+            std::size_t operator()(const ImageKey& key) const;
+        };
+
+        // Information that is shared by all loaded parts of an image.
+        // The texture is only set when the image was placed in a texture that is shared by all parts of that image.
+        struct SharedImage
+        {
+            std::weak_ptr<sf::Texture> texture;
+            sf::IntRect rect;
+            unsigned int parts = 0;
+        };
+
+        // Texture in which small images are packed. The images are placed next to each other on a shelf and a new shelf
+        // is started below the highest image when the current shelf is full.
+        struct AtlasPage
+        {
+            std::weak_ptr<sf::Texture> texture;
+            unsigned int shelfTop = 0;
+            unsigned int shelfHeight = 0;
+            unsigned int shelfRight = 0;
+        };
+
+        static std::unordered_map<ImageKey, TextureDataHolder, ImageKeyHash> m_imageMap;
+        static std::unordered_map<std::string, SharedImage> m_sharedImages;
+        static std::vector<AtlasPage> m_atlasPages;
+        static bool m_atlasEnabled;
+        static bool m_keepImagesInMemory;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
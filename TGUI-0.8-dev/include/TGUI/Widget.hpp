@@ -491,6 +491,37 @@ namespace tgui
         bool isContainer() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks the widget as changed, so that the gui knows that it has to be drawn again
+        ///
+        /// The widgets already call this function themselves when one of their properties changes. You only need to call it
+        /// when something changes that affects how a widget looks without going through its functions, e.g. in a custom widget.
+        ///
+        /// @see Gui::needsRedraw
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns whether the widget or one of its children changed since the last time that markAsDrawn was called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isInvalidated() const
+        {
+            return m_invalidated;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Resets the flag that is set by invalidate, after the widget has been drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void markAsDrawn()
+        {
+            m_invalidated = false;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// This function is called when the widget is added to a container.
@@ -625,6 +656,11 @@ namespace tgui
         ///
         /// This is a pure virtual function that has to be implemented by the derived class to define how the widget is drawn.
         ///
+        /// Widgets that draw everything with PrimitiveBatch::draw should set m_drawnThroughPrimitiveBatch to true in their
+        /// constructor, so that their primitives can be clipped on the cpu and drawn together with those of other widgets.
+        /// Other widgets can draw directly to the target: the parent draws the collected primitives before calling this
+        /// function and sets a view that only shows the clipping area while the widget is drawn.
+        ///
         /// @param target Render target to draw to
         /// @param states Current render states
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -785,6 +821,10 @@ namespace tgui
         // Is the widget focused?
         bool m_focused = false;
 
+        // Did the widget or one of its children change since it was last drawn?
+        // Containers that cache their contents reset the flag while drawing.
+        mutable bool m_invalidated = true;
+
         // Keep track of the elapsed time.
         sf::Time m_animationTimeElapsed;
 
@@ -794,6 +834,9 @@ namespace tgui
         // This is set to true for widgets that store other widgets inside them
         bool m_containerWidget = false;
 
+        // This is set to true for widgets that only draw via PrimitiveBatch, so that they don't need a clipping view
+        bool m_drawnThroughPrimitiveBatch = false;
+
         // The tool tip connected to the widget
         Widget::Ptr m_toolTip = nullptr;
 
@@ -823,7 +866,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        friend class Container; // Container accesses m_mouseDown, m_draggableWidget, save and load
+        friend class Container; // Container accesses m_mouseDown, m_draggableWidget, m_drawnThroughPrimitiveBatch, save and load
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
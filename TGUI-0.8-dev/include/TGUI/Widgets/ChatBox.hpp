@@ -31,6 +31,10 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ChatBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
 #include <deque>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -46,13 +50,66 @@ namespace tgui
         typedef std::shared_ptr<ChatBox> Ptr; ///< Shared widget pointer
         typedef std::shared_ptr<const ChatBox> ConstPtr; ///< Shared constant widget pointer
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Part of a line that has its own color and style
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Span
+        {
+            Span(const sf::String& spanText = "", Color spanColor = {}, TextStyle spanStyle = {}, const sf::String& spanLink = "") :
+                text {spanText},
+                color{spanColor},
+                style{spanStyle},
+                link {spanLink}
+            {
+            }
+
+            sf::String text; ///< Text of this part of the line
+            Color color;     ///< Color of the text, the default text color is used when the color isn't set
+            TextStyle style; ///< Style of the text (e.g. sf::Text::Bold), the text is regular when the style isn't set
+            sf::String link; ///< Id passed to the onLinkClick signal when the span is clicked, empty if the span isn't a link
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        struct SpanFormat
+        {
+            std::uint32_t end = 0; // Index of the character after the last character of the span
+            Color color;
+            unsigned int style = 0;
+            std::string link; // UTF-8 encoded id of the link, empty if the span isn't a link
+        };
+
         struct Line
         {
-            Text text;
-            sf::String string;
+            std::size_t chunk = 0; // Id of the text chunk in which the UTF-8 encoded text of the line is stored
+            std::uint32_t offset = 0; // Position of the text inside the chunk, in bytes
+            std::uint32_t length = 0; // Length of the text, in bytes
+            Color color;
+            float top = 0; // Vertical position of the line, the first line is not necessarily located at 0
+            float height = 0; // Estimated height until the line is word-wrapped for the current wrap generation
+            unsigned int wrapGeneration = 0; // Line is only up-to-date when this matches the wrap generation of the chat box
+            std::vector<std::uint32_t> wrapPositions; // Character indices at which the word-wrap splits the line
+            std::vector<SpanFormat> spans; // Empty when the whole line has the same color and no style
+        };
+
+        struct LinkArea
+        {
+            FloatRect rect; // Position relative to the first visible line
+            std::string link; // UTF-8 encoded id of the link
+        };
+
+        struct TextChunk
+        {
+            std::string data; // UTF-8 encoded texts of consecutive lines
+            std::size_t lineCount = 0; // Amount of lines that still have their text stored in this chunk
+        };
+
+        struct VisibleLine
+        {
+            std::size_t chunk = 0; // The chunk and offset identify the line of which the glyphs are in the vertex array
+            std::uint32_t offset = 0;
+            unsigned int wrapGeneration = 0;
         };
 
 
@@ -138,9 +195,51 @@ namespace tgui
         void addLine(const sf::String& text, Color color);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple lines of text to the chat box at once
+        ///
+        /// The result is the same as calling addLine for each of the strings, but the scrollbar is only updated once.
+        /// This function should be preferred when many lines arrive at the same time (e.g. when receiving a backlog).
+        ///
+        /// The default text color will be used.
+        ///
+        /// @param lines  Texts that will be added to the chat box, in the order in which they would be passed to addLine
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addLines(const std::vector<sf::String>& lines);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple lines of text to the chat box at once
+        ///
+        /// The result is the same as calling addLine for each of the strings, but the scrollbar is only updated once.
+        /// This function should be preferred when many lines arrive at the same time (e.g. when receiving a backlog).
+        ///
+        /// @param lines  Texts that will be added to the chat box, in the order in which they would be passed to addLine
+        /// @param color  Color of the text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addLines(const std::vector<sf::String>& lines, Color color);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a new line to the chat box that consists of parts with a different color or style
+        ///
+        /// The texts of the spans are concatenated and the result is treated as a single line, e.g. by getLine.
+        /// A span with a link id triggers the onLinkClick signal when it is clicked.
+        ///
+        /// @code
+        /// chatBox->addLine({{"[12:34] ", sf::Color(128, 128, 128)}, {"Nickname", sf::Color::Blue, sf::Text::Bold, "user:Nickname"}, {": Hello"}});
+        /// @endcode
+        ///
+        /// @param spans  Parts of the line, in the order in which they are shown
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addLine(const std::vector<Span>& spans);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the contents of the requested line
         ///
+        /// For lines that were added with spans, the texts of all spans are returned together.
+        ///
         /// @param lineIndex  The index of the line of which you request the contents
         ///                   The first line has index 0
         ///
@@ -331,29 +430,97 @@ namespace tgui
     private:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates the text attribute of the line
+        // Recalculates the text attribute of the line, which word-wraps the line for the current wrap generation
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateLineText(Line& line);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates all text attributes, recalculate the full text height and update the displayed text
+        // Stores the text of the line in the last text chunk, a new chunk is started when it doesn't fit
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void storeLineText(Line& line, const sf::String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the text chunk of the line that the line was removed, chunks are freed when no line uses them anymore
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void releaseLineText(const Line& line);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Decodes the text of the line that is stored in its text chunk
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String getLineText(const Line& line) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks all lines as outdated, gives them an estimated height and updates the displayed text.
+        // This is called when the font, text size or width changes. Lines are only word-wrapped again once they become visible.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateAllLines();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates the space used by all the lines
+        // Returns the height that a line is expected to have once it gets word-wrapped, based on the length of its UTF-8 text
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void recalculateFullTextHeight();
+        float estimateLineHeight(std::size_t length) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Updates the position of the lines
+        // Returns the width available for the text, which is the width at which the lines are word-wrapped
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getMaxLineWidth() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a line without updating the scrollbar, the line limit is taken into account
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertLine(const sf::String& text, Color color, std::vector<SpanFormat> spans);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the vertical position of every line, which is needed when the height of the lines changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recalculateLinePositions();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the space used by all the lines and the scrollbar, based on the positions of the first and last line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateFullTextHeight();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the line that is located at the given distance from the top of the first line.
+        // The amount of lines is returned when the position lies below the last line.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLineIndexAtHeight(float height) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Word-wraps the outdated lines that are visible and updates the position of the lines when their height changed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateDisplayedText();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Finds the lines that are visible and rebuilds the vertices of the text when they differ from the previous time
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleLines();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Fills the vertex array with the glyphs of all visible lines, relative to the top of the first visible line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildTextVertices();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the link that is located at the given mouse position, or nullptr when there is no link at that position
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const LinkArea* getLinkAtPosition(Vector2f pos) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the position and size of the panel and scrollbar
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -373,6 +540,18 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Retrieves a signal based on its name
+        ///
+        /// @param signalName  Name of the signal
+        ///
+        /// @return Signal that corresponds to the name
+        ///
+        /// @throw Exception when the name does not match any signal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Signal& getSignal(std::string signalName) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
@@ -409,6 +588,12 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    public:
+
+        SignalString onLinkClick = {"LinkClicked"}; ///< A span with a link id was clicked. Optional parameter: link id of the span
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -419,6 +604,14 @@ namespace tgui
 
         float m_fullTextHeight = 0;
 
+        // Incremented each time the lines have to be word-wrapped again
+        unsigned int m_wrapGeneration = 1;
+
+        // Values used to estimate the height of lines that aren't word-wrapped yet
+        float m_estimatedCharacterWidth = 0;
+        float m_lineSpacingCached = 0;
+        float m_extraVerticalSpaceCached = 0;
+
         bool m_linesStartFromTop = false;
         bool m_newLinesBelowOthers = true;
 
@@ -426,6 +619,24 @@ namespace tgui
 
         std::deque<Line> m_lines;
 
+        // The texts of all lines are stored in large chunks instead of having a separate allocation per line
+        std::deque<TextChunk> m_textChunks;
+        std::size_t m_firstTextChunkId = 0;
+
+        // The glyphs of all visible lines are drawn with a single vertex array, which only changes when other lines become visible
+        std::vector<VisibleLine> m_visibleLines;
+        std::size_t m_firstVisibleLine = 0;
+        sf::VertexArray m_textVertices{sf::Triangles};
+        std::vector<LinkArea> m_linkAreas;
+
+#if SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR < 4
+        // The font texture has no white pixel in older SFML versions, so underlines are drawn separately without a texture
+        sf::VertexArray m_lineVertices{sf::Triangles};
+#endif
+
+        // Reused when word-wrapping a line, to avoid allocating memory for every line
+        std::vector<Text::WrappedLine> m_wrappedLines;
+
         Sprite m_spriteBackground;
 
         // Cached renderer properties
@@ -30,7 +30,7 @@
 #include <TGUI/Renderers/EditBoxRenderer.hpp>
 #include <TGUI/FloatRect.hpp>
 #include <TGUI/Text.hpp>
-#include <regex>
+#include <TGUI/InputValidator.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -371,6 +371,10 @@ namespace tgui
         /// When the regex does not match when calling the setText function then the edit box contents will be cleared.
         /// When it does not match when the user types a character in the edit box, then the input character is rejected.
         ///
+        /// The predefined validators from EditBox::Validator are not checked with a regex, only the typed character and the
+        /// characters next to it are checked. Any other regex is compiled once and has to match the whole text each time a
+        /// character is typed.
+        ///
         /// Examples:
         /// @code
         /// edit1->setInputValidator(EditBox::Validator::Int);
@@ -380,10 +384,27 @@ namespace tgui
         void setInputValidator(const std::string& regex = ".*");
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Defines how the text input should look like
+        ///
+        /// @param validator  Object that decides which text is accepted, or nullptr to accept any input
+        ///
+        /// When the text is not valid when calling the setText function then the edit box contents will be cleared.
+        /// When a character that the user types is not accepted by the validator, then the input character is rejected.
+        ///
+        /// Example:
+        /// @code
+        /// editBox->setInputValidator(std::make_shared<tgui::MaxLengthValidator>(10));
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setInputValidator(std::shared_ptr<InputValidator> validator);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the regex to which the text is matched
         ///
-        /// @return Regex to match the text with on every text change
+        /// @return Regex to match the text with on every text change, or an empty string when a validator object was passed
+        ///         to setInputValidator
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         const std::string& getInputValidator() const;
@@ -498,6 +519,13 @@ namespace tgui
         std::size_t findCaretPosition(float posX);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the horizontal position of every character in the displayed text, which is only recalculated after the
+        // displayed text or its properties changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<float>& getCharacterPositions();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Removes the selected characters. This function is called when pressing backspace, delete or a letter while there were
         // some characters selected.
@@ -561,8 +589,9 @@ namespace tgui
         // The text inside the edit box
         sf::String    m_text;
 
+        // The validator that checks the text, which is a nullptr when any input is accepted
         std::string   m_regexString = ".*";
-        std::regex    m_regex = std::regex{m_regexString};
+        std::shared_ptr<InputValidator> m_inputValidator;
 
         // This will store the size of the text ( 0 to auto size )
         unsigned int  m_textSize = 0;
@@ -601,6 +630,10 @@ namespace tgui
         Text m_defaultText;
         Text m_textFull;
 
+        // Position of each character in m_textFull, used to find the caret position without measuring the text each time
+        std::vector<float> m_characterPositions;
+        bool m_characterPositionsOutdated = true;
+
         Sprite m_sprite;
         Sprite m_spriteHover;
         Sprite m_spriteDisabled;
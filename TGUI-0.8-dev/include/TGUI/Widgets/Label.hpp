@@ -360,6 +360,24 @@ namespace tgui
         void rearrangeText();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Word-wraps the text again and changes the strings of the lines that are no longer the same.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateLines(float maxWidth);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the amount of lines, the lines that are added get the properties of the text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resizeLines(std::size_t lineCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether word-wrapping the text for the given width would result in the lines that already exist.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isWrappedForWidth(float maxWidth) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -381,6 +399,16 @@ namespace tgui
         sf::String m_string;
         std::vector<Text> m_lines;
 
+        // Reused when word-wrapping the text, to avoid allocating memory every time the text changes
+        std::vector<Text::WrappedLine> m_wrappedLines;
+
+        // The width for which the lines were word-wrapped and whether they have to be word-wrapped again regardless of the width
+        float m_wrappedWidth = 0;
+        bool m_linesOutdated = true;
+
+        // Set when the font, text size or text style of the existing lines has to be changed
+        bool m_linePropertiesOutdated = false;
+
         unsigned int m_textSize = 0;
         HorizontalAlignment m_horizontalAlignment = HorizontalAlignment::Left;
         VerticalAlignment m_verticalAlignment = VerticalAlignment::Top;
@@ -399,6 +399,22 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns whether the scrollbar has to be drawn differently because the mouse entered or left it or moved to
+        ///        another part of it since the previous call
+        ///
+        /// The scrollbar has no parent that it could invalidate, so the widget that owns it has to call this function after
+        /// passing mouse events to it and invalidate itself when it returns true.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool hasHoverChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // The hover state as it was during the previous call to hasHoverChanged
+        bool m_previousMouseHover = false;
+        Part m_previousHoverPart = Part::Thumb;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/TextBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <TGUI/TextRope.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -128,6 +129,9 @@ namespace tgui
         ///
         /// @return  The text that is currently inside the text box
         ///
+        /// The text box doesn't store its text as a single string, so the string is only created when this function is called
+        /// after the text was changed.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         const sf::String& getText() const;
 
@@ -335,6 +339,12 @@ namespace tgui
         sf::Vector2<std::size_t> findCaretPosition(Vector2f position) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the horizontal position of every character in a line, which is only calculated again after the line changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<float>& getLineCharacterPositions(std::size_t line) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Converts the two dimensional selection positions into one dimensional positions in the text.
         // The first element of the pair is the selection start and the second one is the selection end.
@@ -342,6 +352,12 @@ namespace tgui
         std::pair<std::size_t, std::size_t> findTextSelectionPositions() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Converts a one dimensional position in the text into a line and a position on that line.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Vector2<std::size_t> findLinePosition(std::size_t textPosition) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called when you are selecting text.
         // It will find out which part of the text is selected.
@@ -363,7 +379,39 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function will split the text into five pieces so that the text can be easily drawn.
+        // Rearrange the whole text and place the selection on the given positions in the text afterwards.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rearrangeText(std::size_t selStart, std::size_t selEnd);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rearrange the text after erasedCount characters at pos were replaced by insertedCount characters. Only the lines from
+        // the paragraph containing the change until the first line that starts at the same place as before are wrapped again.
+        // The selection is placed on the given positions in the text afterwards.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rearrangeChangedText(std::size_t pos, std::size_t erasedCount, std::size_t insertedCount, std::size_t selStart, std::size_t selEnd);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Places the selection and updates the scrollbar after the lines have been rearranged.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void finishRearrangeText(std::size_t selStart, std::size_t selEnd);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Emits the TextChanged signal, the text is only turned into a string when someone is connected to the signal.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void emitTextChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width available for a line of text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getMaximumLineWidth() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure that the caret is visible after the selection changed and updates the text objects when needed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateSelectionTexts();
 
@@ -405,6 +453,14 @@ namespace tgui
         void recalculateVisibleLines();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function will split the lines around the visible area into five pieces so that the text can be easily drawn.
+        // The text objects are only changed when the visible lines are no longer part of them or when the lines or the
+        // selection changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleTexts();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves a signal based on its name
         ///
@@ -456,12 +512,26 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        sf::String   m_text;
+        TextRope     m_text;
         unsigned int m_textSize = 18;
         unsigned int m_lineHeight = 24;
 
         std::vector<sf::String> m_lines;
 
+        // Position of each character within its line, a line whose positions weren't calculated yet has an empty vector
+        mutable std::vector<std::vector<float>> m_lineCharacterPositions;
+
+        // Where each of the lines is located in the text, this is empty when the text could not be arranged
+        std::vector<Text::WrappedLine> m_wrappedLines;
+
+        // Reused when wrapping part of the text again after it was changed
+        std::vector<Text::WrappedLine> m_changedLines;
+        sf::String m_changedText;
+
+        // String returned by getText, which is only updated when it is requested after the text changed
+        mutable sf::String m_textAsString;
+        mutable bool m_textAsStringOutdated = false;
+
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
 
@@ -485,6 +555,13 @@ namespace tgui
 
         std::vector<FloatRect> m_selectionRects;
 
+        // Which lines and selection were last placed in the text objects
+        std::size_t m_renderedLinesBegin = 0;
+        std::size_t m_renderedLinesEnd = 0;
+        sf::Vector2<std::size_t> m_renderedSelStart;
+        sf::Vector2<std::size_t> m_renderedSelEnd;
+        bool m_renderedLinesOutdated = true;
+
         // The scrollbar
         CopiedSharedPtr<ScrollbarChildWidget> m_verticalScroll;
 
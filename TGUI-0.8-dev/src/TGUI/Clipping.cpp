@@ -24,87 +24,95 @@
 
 
 #include <TGUI/Clipping.hpp>
+#include <algorithm>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    std::vector<Clipping::ClipArea> Clipping::m_clipAreas;
     sf::View Clipping::m_originalView;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Clipping::Clipping(sf::RenderTarget& target, const sf::RenderStates& states, Vector2f topLeft, Vector2f size) :
-        m_target {target},
-        m_oldView{target.getView()}
+    Clipping::Clipping(sf::RenderTarget& target, const sf::RenderStates& states, Vector2f topLeft, Vector2f size)
     {
-        Vector2f bottomRight = Vector2f(states.transform.transformPoint(topLeft + size));
-        topLeft = Vector2f(states.transform.transformPoint(topLeft));
-
-        Vector2f viewTopLeft = topLeft;
-        size = bottomRight - topLeft;
+        const Vector2f corner1 = states.transform.transformPoint(topLeft);
+        const Vector2f corner2 = states.transform.transformPoint(topLeft + size);
+
+        // Nothing is drawn outside the area that is already being clipped, or outside the gui view when clipping starts
+        FloatRect outerRect;
+        const FloatRect* clipRect = getClipRect(target);
+        if (clipRect)
+            outerRect = *clipRect;
+        else
+            outerRect = {m_originalView.getCenter() - (m_originalView.getSize() / 2.f), m_originalView.getSize()};
+
+        const float left = std::max(std::min(corner1.x, corner2.x), outerRect.left);
+        const float top = std::max(std::min(corner1.y, corner2.y), outerRect.top);
+        const float right = std::min(std::max(corner1.x, corner2.x), outerRect.left + outerRect.width);
+        const float bottom = std::min(std::max(corner1.y, corner2.y), outerRect.top + outerRect.height);
+
+        m_clipAreas.push_back({&target, {left, top, std::max(right - left, 0.f), std::max(bottom - top, 0.f)}});
+    }
 
-        topLeft.x -= m_originalView.getCenter().x - (m_originalView.getSize().x / 2.f);
-        topLeft.y -= m_originalView.getCenter().y - (m_originalView.getSize().y / 2.f);
-        bottomRight.x -= m_originalView.getCenter().x - (m_originalView.getSize().x / 2.f);
-        bottomRight.y -= m_originalView.getCenter().y - (m_originalView.getSize().y / 2.f);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        topLeft.x *= m_originalView.getViewport().width / m_originalView.getSize().x;
-        topLeft.y *= m_originalView.getViewport().height / m_originalView.getSize().y;
-        size.x *= m_originalView.getViewport().width / m_originalView.getSize().x;
-        size.y *= m_originalView.getViewport().height / m_originalView.getSize().y;
+    Clipping::~Clipping()
+    {
+        m_clipAreas.pop_back();
+    }
 
-        topLeft.x += m_originalView.getViewport().left;
-        topLeft.y += m_originalView.getViewport().top;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        if (topLeft.x < m_oldView.getViewport().left)
-        {
-            size.x -= m_oldView.getViewport().left - topLeft.x;
-            viewTopLeft.x += (m_oldView.getViewport().left - topLeft.x) * (m_originalView.getSize().x / m_originalView.getViewport().width);
-            topLeft.x = m_oldView.getViewport().left;
-        }
-        if (topLeft.y < m_oldView.getViewport().top)
+    const FloatRect* Clipping::getClipRect(const sf::RenderTarget& target)
+    {
+        // The areas of other targets (e.g. the window while a container renders its contents to a texture) are skipped
+        for (auto it = m_clipAreas.rbegin(); it != m_clipAreas.rend(); ++it)
         {
-            size.y -= m_oldView.getViewport().top - topLeft.y;
-            viewTopLeft.y += (m_oldView.getViewport().top - topLeft.y) * (m_originalView.getSize().y / m_originalView.getViewport().height);
-            topLeft.y = m_oldView.getViewport().top;
+            if (it->target == &target)
+                return &it->rect;
         }
 
-        if (size.x > m_oldView.getViewport().left + m_oldView.getViewport().width - topLeft.x)
-            size.x = m_oldView.getViewport().left + m_oldView.getViewport().width - topLeft.x;
-        if (size.y > m_oldView.getViewport().top + m_oldView.getViewport().height - topLeft.y)
-            size.y = m_oldView.getViewport().top + m_oldView.getViewport().height - topLeft.y;
+        return nullptr;
+    }
 
-        if ((size.x >= 0) && (size.y >= 0))
-        {
-            sf::View view{{std::round(viewTopLeft.x),
-                           std::round(viewTopLeft.y),
-                           std::round(size.x * m_originalView.getSize().x / m_originalView.getViewport().width),
-                           std::round(size.y * m_originalView.getSize().y / m_originalView.getViewport().height)}};
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            view.setViewport({topLeft.x, topLeft.y, size.x, size.y});
-            target.setView(view);
-        }
-        else // The clipping area lies outside the viewport
+    sf::View Clipping::getClippingView(const FloatRect& clipRect)
+    {
+        if ((clipRect.width <= 0) || (clipRect.height <= 0))
         {
             sf::View emptyView{{0, 0, 0, 0}};
             emptyView.setViewport({0, 0, 0, 0});
-            target.setView(emptyView);
+            return emptyView;
         }
+
+        const FloatRect& viewport = m_originalView.getViewport();
+        const Vector2f viewTopLeft = m_originalView.getCenter() - (m_originalView.getSize() / 2.f);
+        const Vector2f scale = {viewport.width / m_originalView.getSize().x, viewport.height / m_originalView.getSize().y};
+
+        sf::View view{{std::round(clipRect.left), std::round(clipRect.top), std::round(clipRect.width), std::round(clipRect.height)}};
+        view.setViewport({viewport.left + ((clipRect.left - viewTopLeft.x) * scale.x),
+                          viewport.top + ((clipRect.top - viewTopLeft.y) * scale.y),
+                          clipRect.width * scale.x,
+                          clipRect.height * scale.y});
+        return view;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Clipping::~Clipping()
+    void Clipping::setGuiView(const sf::View& view)
     {
-        m_target.setView(m_oldView);
+        m_originalView = view;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Clipping::setGuiView(const sf::View& view)
+    const sf::View& Clipping::getGuiView()
     {
-        m_originalView = view;
+        return m_originalView;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,9 +27,14 @@
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
+#include <TGUI/Clipping.hpp>
+#include <TGUI/PrimitiveBatch.hpp>
+
+#include <SFML/Graphics/Sprite.hpp>
 
 #include <cassert>
 #include <fstream>
+#include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -100,7 +105,8 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container(const Container& other) :
-        Widget{other}
+        Widget          {other},
+        m_renderCaching {other.m_renderCaching}
     {
         // Copy all the widgets
         for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
@@ -115,7 +121,8 @@ namespace tgui
         m_widgetNames         {std::move(other.m_widgetNames)},
         m_widgetBelowMouse    {std::move(other.m_widgetBelowMouse)},
         m_focusedWidget       {std::move(other.m_focusedWidget)},
-        m_handingMouseReleased{std::move(other.m_handingMouseReleased)}
+        m_handingMouseReleased{std::move(other.m_handingMouseReleased)},
+        m_renderCaching       {std::move(other.m_renderCaching)}
     {
         for (auto& widget : m_widgets)
             widget->setParent(this);
@@ -145,6 +152,7 @@ namespace tgui
 
             m_widgetBelowMouse = nullptr;
             m_focusedWidget = nullptr;
+            m_renderCaching = right.m_renderCaching;
 
             // Remove all the old widgets
             Container::removeAllWidgets();
@@ -173,6 +181,7 @@ namespace tgui
             m_widgetBelowMouse     = std::move(right.m_widgetBelowMouse);
             m_focusedWidget        = std::move(right.m_focusedWidget);
             m_handingMouseReleased = std::move(right.m_handingMouseReleased);
+            m_renderCaching        = std::move(right.m_renderCaching);
 
             for (auto& widget : m_widgets)
                 widget->setParent(this);
@@ -198,6 +207,8 @@ namespace tgui
 
         if (m_opacityCached < 1)
             widgetPtr->setInheritedOpacity(m_opacityCached);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -249,6 +260,7 @@ namespace tgui
                 widget->setParent(nullptr);
                 m_widgets.erase(m_widgets.begin() + i);
                 m_widgetNames.erase(m_widgetNames.begin() + i);
+                invalidate();
                 return true;
             }
         }
@@ -268,6 +280,8 @@ namespace tgui
 
         m_widgetBelowMouse = nullptr;
         m_focusedWidget = nullptr;
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -437,6 +451,8 @@ namespace tgui
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i);
             m_widgetNames.erase(m_widgetNames.begin() + i);
+
+            invalidate();
             break;
         }
     }
@@ -460,12 +476,32 @@ namespace tgui
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i + 1);
             m_widgetNames.erase(m_widgetNames.begin() + i + 1);
+
+            invalidate();
             break;
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setRenderCaching(bool cached)
+    {
+        m_renderCaching = cached;
+        if (!cached)
+            m_renderCache = nullptr;
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::getRenderCaching() const
+    {
+        return m_renderCaching;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::focusNextWidget()
     {
         // If the focused widget is a container then try to focus the next widget inside it
@@ -807,6 +843,7 @@ namespace tgui
                     if (widget->m_draggableWidget || widget->isContainer())
                     {
                         widget->mouseMoved(mousePos);
+                        widget->invalidate();
                         return true;
                     }
                 }
@@ -850,11 +887,13 @@ namespace tgui
                  || ((event.type == sf::Event::TouchBegan) && (event.touch.finger == 0)))
                 {
                     widget->leftMousePressed(mousePos);
+                    widget->invalidate();
                     return true;
                 }
                 else if ((event.type == sf::Event::MouseButtonPressed) && (event.mouseButton.button == sf::Mouse::Right))
                 {
                     widget->rightMousePressed(mousePos);
+                    widget->invalidate();
                     return true;
                 }
             }
@@ -883,7 +922,10 @@ namespace tgui
             // Check if the mouse is on top of a widget
             Widget::Ptr widgetBelowMouse = mouseOnWhichWidget(mousePos);
             if (widgetBelowMouse != nullptr)
+            {
                 widgetBelowMouse->leftMouseReleased(mousePos);
+                widgetBelowMouse->invalidate();
+            }
 
             // Tell all widgets that the mouse has gone up
             // But don't do this when leftMouseReleased was called on this container because
@@ -891,7 +933,12 @@ namespace tgui
             if (!m_handingMouseReleased)
             {
                 for (auto& widget : m_widgets)
+                {
+                    if (widget->m_mouseDown)
+                        widget->invalidate();
+
                     widget->mouseNoLongerDown();
+                }
             }
 
             if (widgetBelowMouse != nullptr)
@@ -915,7 +962,8 @@ namespace tgui
                         event.key.code = sf::Keyboard::BackSpace;
                 #endif
 
-                    // Tell the widget that the key was pressed
+                    // Tell the widget that the key was pressed (it may lose focus while handling it, so it is invalidated first)
+                    m_focusedWidget->invalidate();
                     m_focusedWidget->keyPressed(event.key);
                     return true;
                 }
@@ -933,6 +981,7 @@ namespace tgui
                 // Tell the widget that the key was pressed
                 if (m_focusedWidget && m_focusedWidget->isFocused())
                 {
+                    m_focusedWidget->invalidate();
                     m_focusedWidget->textEntered(event.text.unicode);
                     return true;
                 }
@@ -950,6 +999,7 @@ namespace tgui
             {
                 // Send the event to the widget
                 widget->mouseWheelScrolled(event.mouseWheelScroll.delta, {static_cast<float>(event.mouseWheelScroll.x), static_cast<float>(event.mouseWheelScroll.y)});
+                widget->invalidate();
                 return true;
             }
 
@@ -993,13 +1043,89 @@ namespace tgui
         // Draw all widgets when they are visible
         for (const auto& widget : m_widgets)
         {
-            if (widget->isVisible())
+            if (!widget->isVisible())
+                continue;
+
+            if (widget->m_drawnThroughPrimitiveBatch)
+            {
+                widget->draw(*target, states);
+                continue;
+            }
+
+            // The widget may draw directly to the target, which happens before the collected primitives are drawn and
+            // without cutting off what lies outside the clipping area
+            PrimitiveBatch::flush(*target);
+
+            const FloatRect* clipRect = Clipping::getClipRect(*target);
+            if (clipRect)
+            {
+                const sf::View oldView = target->getView();
+                target->setView(Clipping::getClippingView(*clipRect));
+                widget->draw(*target, states);
+                target->setView(oldView);
+            }
+            else
                 widget->draw(*target, states);
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Container::drawCachedContents(sf::RenderTarget& target, const sf::RenderStates& states, Vector2f size,
+                                       const std::function<void(sf::RenderTarget&, const sf::RenderStates&)>& drawContents) const
+    {
+        // Semi-transparent contents would be blended twice when drawn via the texture
+        if (!m_renderCaching || (m_opacityCached < 1) || states.shader)
+            return false;
+
+        // The texture can only be drawn pixel for pixel, so the container may not be scaled or rotated and there must be
+        // as many pixels in the target as there are units in the view.
+        const float* matrix = states.transform.getMatrix();
+        if ((matrix[0] != 1) || (matrix[1] != 0) || (matrix[4] != 0) || (matrix[5] != 1))
+            return false;
+
+        const sf::View& view = target.getView();
+        if ((view.getRotation() != 0)
+         || (std::abs(view.getSize().x - (view.getViewport().width * target.getSize().x)) >= 1)
+         || (std::abs(view.getSize().y - (view.getViewport().height * target.getSize().y)) >= 1))
+            return false;
+
+        const sf::Vector2u textureSize{static_cast<unsigned int>(std::ceil(size.x)), static_cast<unsigned int>(std::ceil(size.y))};
+        if ((size.x <= 0) || (size.y <= 0) || (textureSize.x > sf::Texture::getMaximumSize()) || (textureSize.y > sf::Texture::getMaximumSize()))
+            return false;
+
+        if (!m_renderCache || (m_renderCache->getSize() != textureSize))
+        {
+            m_renderCache = std::make_unique<sf::RenderTexture>();
+            if (!m_renderCache->create(textureSize.x, textureSize.y))
+            {
+                m_renderCache = nullptr;
+                return false;
+            }
+
+            m_invalidated = true;
+        }
+
+        if (m_invalidated)
+        {
+            // Clipping inside the contents has to be calculated relative to the texture instead of the window
+            const sf::View oldGuiView = Clipping::getGuiView();
+            Clipping::setGuiView(m_renderCache->getView());
+
+            m_renderCache->clear(sf::Color::Transparent);
+            drawContents(*m_renderCache, sf::RenderStates::Default);
+            m_renderCache->display();
+
+            Clipping::setGuiView(oldGuiView);
+            m_invalidated = false;
+        }
+
+        PrimitiveBatch::draw(target, sf::Sprite{m_renderCache->getTexture()}, states);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::size_t Container::getFocusedWidgetIndex() const
     {
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
@@ -1056,6 +1182,7 @@ namespace tgui
     GuiContainer::GuiContainer()
     {
         m_type = "GuiContainer";
+        m_drawnThroughPrimitiveBatch = true;
         m_focused = true;
         m_isolatedFocus = true;
     }
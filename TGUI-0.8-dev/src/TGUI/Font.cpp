@@ -26,13 +26,107 @@
 #include <TGUI/Font.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
 
+#include <unordered_map>
 #include <cassert>
 #include <iostream>
+#include <bitset>
+#include <vector>
+#include <array>
+#include <list>
+#include <map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Maximum amount of measured text sizes that are kept per font
+        const std::size_t MaxCachedTextSizes = 1024;
+
+        // Maximum amount of kernings of character pairs outside the ASCII tables that are kept per font
+        const std::size_t MaxCachedKernings = 4096;
+
+        std::uint64_t hashText(const sf::String& text, unsigned int characterSize, std::uint32_t style)
+        {
+            // FNV-1a hash of the characters, the size and the style
+            std::uint64_t hash = 14695981039346656037ULL;
+            const auto addToHash = [&hash](std::uint32_t value){
+                hash ^= value;
+                hash *= 1099511628211ULL;
+            };
+
+            addToHash(characterSize);
+            addToHash(style);
+            for (const std::uint32_t c : text)
+                addToHash(c);
+
+            return hash;
+        }
+
+        const sf::Glyph& loadGlyph(const sf::Font& font, std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
+        {
+        #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+            return font.getGlyph(codePoint, characterSize, bold, outlineThickness);
+        #else
+            (void)outlineThickness;
+            return font.getGlyph(codePoint, characterSize, bold);
+        #endif
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct Font::MetricsCache
+    {
+        struct Glyphs
+        {
+            // Latin-1 characters are looked up directly, other characters are rare enough to be stored in a hash map
+            std::array<sf::Glyph, 256> latin1Glyphs;
+            std::bitset<256> latin1GlyphsLoaded;
+            std::unordered_map<std::uint32_t, sf::Glyph> otherGlyphs;
+
+            // Copy of the advances of the printable ASCII characters, to measure ASCII text without accessing the glyphs
+            std::array<float, 128> asciiAdvances;
+            bool asciiAdvancesLoaded = false;
+        };
+
+        Glyphs& getGlyphs(unsigned int characterSize, bool bold)
+        {
+            // Text is usually measured with the same size many times in a row, which avoids the hash lookup
+            const unsigned int key = (characterSize << 1) | (bold ? 1u : 0u);
+            if (!lastGlyphs || (key != lastGlyphsKey))
+            {
+                lastGlyphs = &glyphs[key];
+                lastGlyphsKey = key;
+            }
+
+            return *lastGlyphs;
+        }
+
+        std::unordered_map<unsigned int, Glyphs> glyphs; // Key is the character size multiplied by two, plus one for bold
+        std::unordered_map<std::uint64_t, float> kernings; // Key contains the character size and both code points, cleared when full
+        std::unordered_map<unsigned int, float> lineSpacings;
+        std::unordered_map<unsigned int, std::vector<float>> asciiKernings; // Vector is empty when there is no kerning
+
+        struct TextSize
+        {
+            std::uint64_t hash;
+            sf::String text;
+            unsigned int characterSize;
+            std::uint32_t style;
+            sf::Vector2f size;
+        };
+
+        // Measured texts with the most recently used one in front, the map finds them based on the hash
+        std::list<TextSize> textSizes;
+        std::unordered_map<std::uint64_t, std::list<TextSize>::iterator> textSizesByHash;
+
+        Glyphs* lastGlyphs = nullptr;
+        unsigned int lastGlyphsKey = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(std::nullptr_t)
@@ -43,7 +137,8 @@ namespace tgui
 
     Font::Font(const std::string& id) :
         m_font(Deserializer::deserialize(ObjectConverter::Type::Font, id).getFont()), // Did not compile with clang 3.6 when using braces
-        m_id  (Deserializer::deserialize(ObjectConverter::Type::String, id).getString()) // Did not compile with clang 3.6 when using braces
+        m_id  (Deserializer::deserialize(ObjectConverter::Type::String, id).getString()), // Did not compile with clang 3.6 when using braces
+        m_metricsCache(getMetricsCache(m_font))
     {
     }
 
@@ -57,14 +152,16 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(const std::shared_ptr<sf::Font>& font) :
-        m_font{font}
+        m_font        {font},
+        m_metricsCache{getMetricsCache(m_font)}
     {
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(const sf::Font& font) :
-        m_font{std::make_shared<sf::Font>(font)}
+        m_font        {std::make_shared<sf::Font>(font)},
+        m_metricsCache{getMetricsCache(m_font)}
     {
     }
 
@@ -74,6 +171,7 @@ namespace tgui
         m_font{std::make_shared<sf::Font>()}
     {
         m_font->loadFromMemory(data, sizeInBytes);
+        m_metricsCache = getMetricsCache(m_font);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -88,6 +186,7 @@ namespace tgui
 
             m_font = other.m_font;
             m_id = other.m_id;
+            m_metricsCache = other.m_metricsCache;
         }
 
         return *this;
@@ -105,6 +204,7 @@ namespace tgui
 
             m_font = std::move(other.m_font);
             m_id = std::move(other.m_id);
+            m_metricsCache = std::move(other.m_metricsCache);
         }
 
         return *this;
@@ -181,32 +281,218 @@ namespace tgui
     {
         assert(m_font != nullptr);
 
-    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        return m_font->getGlyph(codePoint, characterSize, bold, outlineThickness);
-    #else
-        (void)outlineThickness;
-        return m_font->getGlyph(codePoint, characterSize, bold);
-    #endif
+        // Outlined glyphs are rarely measured, so they aren't cached
+        if ((outlineThickness != 0) || !m_metricsCache)
+            return loadGlyph(*m_font, codePoint, characterSize, bold, outlineThickness);
+
+        MetricsCache::Glyphs& glyphs = m_metricsCache->getGlyphs(characterSize, bold);
+        if (codePoint < glyphs.latin1Glyphs.size())
+        {
+            if (!glyphs.latin1GlyphsLoaded[codePoint])
+            {
+                glyphs.latin1Glyphs[codePoint] = loadGlyph(*m_font, codePoint, characterSize, bold, 0);
+                glyphs.latin1GlyphsLoaded[codePoint] = true;
+            }
+
+            return glyphs.latin1Glyphs[codePoint];
+        }
+
+        auto it = glyphs.otherGlyphs.find(codePoint);
+        if (it == glyphs.otherGlyphs.end())
+            it = glyphs.otherGlyphs.emplace(codePoint, loadGlyph(*m_font, codePoint, characterSize, bold, 0)).first;
+
+        return it->second;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int characterSize) const
     {
-        if (m_font)
-            return m_font->getKerning(first, second, characterSize);
-        else
+        if (!m_font)
+            return 0;
+
+        // There is no kerning at the start of a line. The cache key has 21 bits per code point and 22 bits for the size.
+        if ((first == 0) || (second == 0))
             return 0;
+        else if (!m_metricsCache || (first > 0x1FFFFF) || (second > 0x1FFFFF) || (characterSize > 0x3FFFFF))
+            return m_font->getKerning(first, second, characterSize);
+
+        // Printable ASCII pairs are taken from the table when it was already created for this size
+        if ((first >= 32) && (first < 127) && (second >= 32) && (second < 127))
+        {
+            const auto asciiIt = m_metricsCache->asciiKernings.find(characterSize);
+            if (asciiIt != m_metricsCache->asciiKernings.end())
+                return asciiIt->second.empty() ? 0 : asciiIt->second[first * 128 + second];
+        }
+
+        const std::uint64_t key = (static_cast<std::uint64_t>(first) << 43) | (static_cast<std::uint64_t>(second) << 22) | characterSize;
+        const auto it = m_metricsCache->kernings.find(key);
+        if (it != m_metricsCache->kernings.end())
+            return it->second;
+
+        // The characters come from the texts that are shown (e.g. chat messages of other users), so the cache is limited.
+        // Kerning is rare outside ASCII, so the cache is simply emptied when it is full instead of tracking which pairs are used.
+        if (m_metricsCache->kernings.size() >= MaxCachedKernings)
+            m_metricsCache->kernings.clear();
+
+        const float kerning = m_font->getKerning(first, second, characterSize);
+        m_metricsCache->kernings[key] = kerning;
+        return kerning;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     float Font::getLineSpacing(unsigned int characterSize) const
     {
-        if (m_font)
-            return m_font->getLineSpacing(characterSize);
-        else
+        if (!m_font)
             return 0;
+        else if (!m_metricsCache)
+            return m_font->getLineSpacing(characterSize);
+
+        const auto it = m_metricsCache->lineSpacings.find(characterSize);
+        if (it != m_metricsCache->lineSpacings.end())
+            return it->second;
+
+        const float lineSpacing = m_font->getLineSpacing(characterSize);
+        m_metricsCache->lineSpacings[characterSize] = lineSpacing;
+        return lineSpacing;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Texture& Font::getTexture(unsigned int characterSize) const
+    {
+        assert(m_font != nullptr);
+        return m_font->getTexture(characterSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const float* Font::getAsciiAdvances(unsigned int characterSize, bool bold) const
+    {
+        assert(m_font != nullptr);
+        assert(m_metricsCache != nullptr);
+
+        MetricsCache::Glyphs& glyphs = m_metricsCache->getGlyphs(characterSize, bold);
+        if (!glyphs.asciiAdvancesLoaded)
+        {
+            glyphs.asciiAdvances.fill(0);
+            for (std::uint32_t c = 32; c < 127; ++c)
+                glyphs.asciiAdvances[c] = getGlyph(c, characterSize, bold).advance;
+
+            glyphs.asciiAdvancesLoaded = true;
+        }
+
+        return glyphs.asciiAdvances.data();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const float* Font::getAsciiKernings(unsigned int characterSize) const
+    {
+        assert(m_font != nullptr);
+        assert(m_metricsCache != nullptr);
+
+        auto it = m_metricsCache->asciiKernings.find(characterSize);
+        if (it == m_metricsCache->asciiKernings.end())
+        {
+            std::vector<float> kernings(128 * 128, 0.f);
+            bool hasKerning = false;
+            for (std::uint32_t first = 32; first < 127; ++first)
+            {
+                for (std::uint32_t second = 32; second < 127; ++second)
+                {
+                    kernings[first * 128 + second] = m_font->getKerning(first, second, characterSize);
+                    if (kernings[first * 128 + second] != 0)
+                        hasKerning = true;
+                }
+            }
+
+            // Many fonts don't have kerning, in which case the table doesn't have to be kept
+            if (!hasKerning)
+                kernings.clear();
+
+            it = m_metricsCache->asciiKernings.emplace(characterSize, std::move(kernings)).first;
+        }
+
+        return it->second.empty() ? nullptr : it->second.data();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Font::findCachedTextSize(const sf::String& text, unsigned int characterSize, std::uint32_t style, sf::Vector2f& size) const
+    {
+        assert(m_metricsCache != nullptr);
+
+        const auto it = m_metricsCache->textSizesByHash.find(hashText(text, characterSize, style));
+        if (it == m_metricsCache->textSizesByHash.end())
+            return false;
+
+        // Different texts could have the same hash
+        const auto& textSize = *it->second;
+        if ((textSize.characterSize != characterSize) || (textSize.style != style) || (textSize.text != text))
+            return false;
+
+        m_metricsCache->textSizes.splice(m_metricsCache->textSizes.begin(), m_metricsCache->textSizes, it->second);
+        size = textSize.size;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::cacheTextSize(const sf::String& text, unsigned int characterSize, std::uint32_t style, sf::Vector2f size) const
+    {
+        assert(m_metricsCache != nullptr);
+
+        const std::uint64_t hash = hashText(text, characterSize, style);
+        auto& textSizes = m_metricsCache->textSizes;
+        auto& textSizesByHash = m_metricsCache->textSizesByHash;
+
+        // A text with the same hash is replaced
+        const auto it = textSizesByHash.find(hash);
+        if (it != textSizesByHash.end())
+        {
+            textSizes.erase(it->second);
+            textSizesByHash.erase(it);
+        }
+        else if (textSizes.size() >= MaxCachedTextSizes)
+        {
+            textSizesByHash.erase(textSizes.back().hash);
+            textSizes.pop_back();
+        }
+
+        textSizes.push_front({hash, text, characterSize, style, size});
+        textSizesByHash[hash] = textSizes.begin();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<Font::MetricsCache> Font::getMetricsCache(const std::shared_ptr<sf::Font>& font)
+    {
+        if (!font)
+            return nullptr;
+
+        // The caches are only kept alive by the Font objects, the entries of fonts that no longer exist are removed here
+        static std::map<std::weak_ptr<sf::Font>, std::weak_ptr<MetricsCache>, std::owner_less<std::weak_ptr<sf::Font>>> metricsCaches;
+
+        auto it = metricsCaches.find(font);
+        if (it != metricsCaches.end())
+        {
+            if (auto metricsCache = it->second.lock())
+                return metricsCache;
+        }
+
+        for (auto cacheIt = metricsCaches.begin(); cacheIt != metricsCaches.end();)
+        {
+            if (cacheIt->first.expired() || cacheIt->second.expired())
+                cacheIt = metricsCaches.erase(cacheIt);
+            else
+                ++cacheIt;
+        }
+
+        auto metricsCache = std::make_shared<MetricsCache>();
+        metricsCaches[font] = metricsCache;
+        return metricsCache;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -138,6 +138,7 @@ namespace tgui
             m_view = view;
 
         Clipping::setGuiView(m_view);
+        m_container->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -236,16 +237,24 @@ namespace tgui
         else if (event.type == sf::Event::LostFocus)
         {
             m_windowFocused = false;
+            m_container->invalidate();
         }
         else if (event.type == sf::Event::GainedFocus)
         {
             m_windowFocused = true;
+            m_container->invalidate();
         #if SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR < 5
             if (m_accessToWindow)
                 Clipboard::setWindowHandle(static_cast<sf::RenderWindow*>(m_target)->getSystemHandle());
         #endif
         }
+        else if (event.type == sf::Event::Resized)
+        {
+            // The contents of the window have to be drawn again after it was resized
+            m_container->invalidate();
+        }
 
+        // Widgets call invalidate themselves when the event changes how they look
         return m_container->handleEvent(event);
     }
 
@@ -276,18 +285,17 @@ namespace tgui
     {
         assert(m_target != nullptr);
 
-        // Update the time
-        if (m_windowFocused)
-            updateTime(m_clock.restart());
-        else
-            m_clock.restart();
+        updateTime();
 
         // Change the view
         const sf::View oldView = m_target->getView();
         m_target->setView(m_view);
 
-        // Draw the widgets
+        // Draw the widgets, primitives that can share a draw call are only drawn when needed
+        m_primitiveBatch.begin(*m_target);
         m_container->drawWidgetContainer(m_target, sf::RenderStates::Default);
+        m_primitiveBatch.end();
+        m_container->markAsDrawn();
 
         // Restore the old view
         m_target->setView(oldView);
@@ -295,6 +303,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Gui::needsRedraw()
+    {
+        // Animations, the blinking caret and tool tips depend on the time, so the time is updated before checking
+        updateTime();
+
+        return m_container->isInvalidated();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::drawIfDirty()
+    {
+        if (!needsRedraw())
+            return false;
+
+        draw();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     GuiContainer::Ptr Gui::getContainer() const
     {
         return m_container;
@@ -449,6 +478,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::updateTime()
+    {
+        if (m_windowFocused)
+            updateTime(m_clock.restart());
+        else
+            m_clock.restart();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
         m_container->m_animationTimeElapsed = elapsedTime;
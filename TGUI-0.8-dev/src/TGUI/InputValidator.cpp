@@ -0,0 +1,201 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/InputValidator.hpp>
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        bool isDigit(std::uint32_t c)
+        {
+            return (c >= '0') && (c <= '9');
+        }
+
+        bool isSign(std::uint32_t c)
+        {
+            return (c == '+') || (c == '-');
+        }
+
+        // Returns the character that will follow the inserted character, or 0 when it is inserted at the end
+        std::uint32_t getNextCharacter(const sf::String& text, std::size_t pos, std::size_t erasedCount)
+        {
+            return (pos + erasedCount < text.getSize()) ? text[pos + erasedCount] : 0;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool InputValidator::isValidInsertion(const sf::String& text, std::size_t pos, std::size_t erasedCount, std::uint32_t character) const
+    {
+        sf::String newText = text;
+        newText.erase(pos, erasedCount);
+        newText.insert(pos, character);
+        return isValid(newText);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    IntValidator::IntValidator(bool allowSign) :
+        m_allowSign{allowSign}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool IntValidator::isValid(const sf::String& text) const
+    {
+        auto it = text.begin();
+        if (m_allowSign && (it != text.end()) && isSign(*it))
+            ++it;
+
+        return std::all_of(it, text.end(), isDigit);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool IntValidator::isValidInsertion(const sf::String& text, std::size_t pos, std::size_t erasedCount, std::uint32_t character) const
+    {
+        // The text is valid, so a sign can only be found at the front of the remaining text
+        const std::uint32_t nextChar = getNextCharacter(text, pos, erasedCount);
+        if (isDigit(character))
+            return (pos > 0) || !isSign(nextChar);
+        else if (isSign(character) && m_allowSign)
+            return (pos == 0) && !isSign(nextChar);
+        else
+            return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FloatValidator::isValid(const sf::String& text) const
+    {
+        auto it = text.begin();
+        if ((it != text.end()) && isSign(*it))
+            ++it;
+
+        bool dotFound = false;
+        for (; it != text.end(); ++it)
+        {
+            if ((*it == '.') && !dotFound)
+                dotFound = true;
+            else if (!isDigit(*it))
+                return false;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FloatValidator::isValidInsertion(const sf::String& text, std::size_t pos, std::size_t erasedCount, std::uint32_t character) const
+    {
+        const std::uint32_t nextChar = getNextCharacter(text, pos, erasedCount);
+        if (isDigit(character))
+            return (pos > 0) || !isSign(nextChar);
+        else if (isSign(character))
+            return (pos == 0) && !isSign(nextChar);
+        else if (character == '.')
+        {
+            if ((pos == 0) && isSign(nextChar))
+                return false;
+
+            // There can only be one dot, unless the existing one is being replaced
+            const auto erasedBegin = text.begin() + pos;
+            const auto erasedEnd = erasedBegin + erasedCount;
+            return (std::find(text.begin(), erasedBegin, '.') == erasedBegin) && (std::find(erasedEnd, text.end(), '.') == text.end());
+        }
+        else
+            return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MaxLengthValidator::MaxLengthValidator(std::size_t maxLength) :
+        m_maxLength{maxLength}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MaxLengthValidator::isValid(const sf::String& text) const
+    {
+        return text.getSize() <= m_maxLength;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MaxLengthValidator::isValidInsertion(const sf::String& text, std::size_t, std::size_t erasedCount, std::uint32_t) const
+    {
+        return text.getSize() - erasedCount < m_maxLength;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CharacterClassValidator::CharacterClassValidator(std::function<bool(std::uint32_t)> isAllowed) :
+        m_isAllowed{std::move(isAllowed)}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool CharacterClassValidator::isValid(const sf::String& text) const
+    {
+        return std::all_of(text.begin(), text.end(), [this](std::uint32_t c){ return m_isAllowed(c); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool CharacterClassValidator::isValidInsertion(const sf::String&, std::size_t, std::size_t, std::uint32_t character) const
+    {
+        return m_isAllowed(character);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RegexValidator::RegexValidator(const std::string& regex) :
+        m_regex{regex}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool RegexValidator::isValid(const sf::String& text) const
+    {
+        // Characters that can't be converted to ANSI would not be checked correctly by the regex
+        if (std::any_of(text.begin(), text.end(), [](std::uint32_t c){ return c > 255; }))
+            return false;
+
+        return std::regex_match(text.toAnsiString(), m_regex);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,257 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/PrimitiveBatch.hpp>
+#include <TGUI/Clipping.hpp>
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    PrimitiveBatch* PrimitiveBatch::m_activeBatch = nullptr;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace
+    {
+        bool isSameView(const sf::View& left, const sf::View& right)
+        {
+            return (left.getCenter() == right.getCenter())
+                && (left.getSize() == right.getSize())
+                && (left.getRotation() == right.getRotation())
+                && (left.getViewport() == right.getViewport());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Objects that aren't drawn via the batch can't be clipped on the cpu, so they are drawn with a view that only shows
+        // the clipping area
+        template <typename DrawFunc>
+        void drawWithClipping(sf::RenderTarget& target, const DrawFunc& drawFunc)
+        {
+            const FloatRect* clipRect = Clipping::getClipRect(target);
+            if (clipRect)
+            {
+                const sf::View oldView = target.getView();
+                target.setView(Clipping::getClippingView(*clipRect));
+                drawFunc();
+                target.setView(oldView);
+            }
+            else
+                drawFunc();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        sf::Vertex interpolate(const sf::Vertex& from, const sf::Vertex& to, float ratio)
+        {
+            const auto interpolateComponent = [ratio](sf::Uint8 fromValue, sf::Uint8 toValue){
+                return static_cast<sf::Uint8>(fromValue + ((toValue - fromValue) * ratio) + 0.5f);
+            };
+
+            return {from.position + ((to.position - from.position) * ratio),
+                    {interpolateComponent(from.color.r, to.color.r),
+                     interpolateComponent(from.color.g, to.color.g),
+                     interpolateComponent(from.color.b, to.color.b),
+                     interpolateComponent(from.color.a, to.color.a)},
+                    from.texCoords + ((to.texCoords - from.texCoords) * ratio)};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Cuts off the part of a convex polygon that lies on the wrong side of a vertical or horizontal line
+        void clipPolygon(const std::vector<sf::Vertex>& polygon, std::vector<sf::Vertex>& clippedPolygon, bool vertical, float line, bool keepGreater)
+        {
+            const auto distance = [=](const sf::Vertex& vertex){
+                const float coordinate = vertical ? vertex.position.x : vertex.position.y;
+                return keepGreater ? (coordinate - line) : (line - coordinate);
+            };
+
+            clippedPolygon.clear();
+            for (std::size_t i = 0; i < polygon.size(); ++i)
+            {
+                const sf::Vertex& current = polygon[i];
+                const sf::Vertex& next = polygon[(i + 1) % polygon.size()];
+                const float currentDistance = distance(current);
+                const float nextDistance = distance(next);
+
+                if (currentDistance >= 0)
+                    clippedPolygon.push_back(current);
+
+                if ((currentDistance >= 0) != (nextDistance >= 0))
+                    clippedPolygon.push_back(interpolate(current, next, currentDistance / (currentDistance - nextDistance)));
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PrimitiveBatch::begin(sf::RenderTarget& target)
+    {
+        m_target = &target;
+        m_vertices.clear();
+        m_activeBatch = this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PrimitiveBatch::end()
+    {
+        drawCollectedVertices();
+
+        m_target = nullptr;
+        if (m_activeBatch == this)
+            m_activeBatch = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PrimitiveBatch::draw(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type,
+                              const sf::RenderStates& states)
+    {
+        PrimitiveBatch* batch = m_activeBatch;
+        if (!batch || (batch->m_target != &target) || states.shader
+         || ((type != sf::PrimitiveType::Triangles) && (type != sf::PrimitiveType::TrianglesStrip)))
+        {
+            flush(target);
+            drawWithClipping(target, [&]{ target.draw(vertices, vertexCount, type, states); });
+            return;
+        }
+
+        // Primitives can only be added to the buffer when they would be drawn with the same states
+        const sf::View& view = target.getView();
+        if ((states.texture != batch->m_texture) || (states.blendMode != batch->m_blendMode) || !isSameView(view, batch->m_view))
+        {
+            batch->drawCollectedVertices();
+            batch->m_texture = states.texture;
+            batch->m_blendMode = states.blendMode;
+            batch->m_view = view;
+        }
+
+        const FloatRect* clipRect = Clipping::getClipRect(target);
+        const auto addTriangle = [batch, &states, clipRect](const sf::Vertex& vertex1, const sf::Vertex& vertex2, const sf::Vertex& vertex3){
+            batch->addTriangle({states.transform.transformPoint(vertex1.position), vertex1.color, vertex1.texCoords},
+                               {states.transform.transformPoint(vertex2.position), vertex2.color, vertex2.texCoords},
+                               {states.transform.transformPoint(vertex3.position), vertex3.color, vertex3.texCoords},
+                               clipRect);
+        };
+
+        if (type == sf::PrimitiveType::Triangles)
+        {
+            for (std::size_t i = 2; i < vertexCount; i += 3)
+                addTriangle(vertices[i-2], vertices[i-1], vertices[i]);
+        }
+        else // Triangle strips are split into separate triangles
+        {
+            for (std::size_t i = 2; i < vertexCount; ++i)
+                addTriangle(vertices[i-2], vertices[i-1], vertices[i]);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PrimitiveBatch::draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states)
+    {
+        flush(target);
+        drawWithClipping(target, [&]{ target.draw(drawable, states); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PrimitiveBatch::flush(sf::RenderTarget& target)
+    {
+        if (m_activeBatch && (m_activeBatch->m_target == &target))
+            m_activeBatch->drawCollectedVertices();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PrimitiveBatch::addTriangle(const sf::Vertex& vertex1, const sf::Vertex& vertex2, const sf::Vertex& vertex3, const FloatRect* clipRect)
+    {
+        if (clipRect)
+        {
+            const float clipRight = clipRect->left + clipRect->width;
+            const float clipBottom = clipRect->top + clipRect->height;
+            const float minX = std::min({vertex1.position.x, vertex2.position.x, vertex3.position.x});
+            const float maxX = std::max({vertex1.position.x, vertex2.position.x, vertex3.position.x});
+            const float minY = std::min({vertex1.position.y, vertex2.position.y, vertex3.position.y});
+            const float maxY = std::max({vertex1.position.y, vertex2.position.y, vertex3.position.y});
+
+            // Skip the triangle when it lies completely outside the clipping area
+            if ((clipRect->width <= 0) || (clipRect->height <= 0)
+             || (maxX <= clipRect->left) || (minX >= clipRight) || (maxY <= clipRect->top) || (minY >= clipBottom))
+                return;
+
+            // Cut the triangle into a polygon that fits inside the clipping area when it doesn't lie completely inside it
+            if ((minX < clipRect->left) || (maxX > clipRight) || (minY < clipRect->top) || (maxY > clipBottom))
+            {
+                m_polygon = {vertex1, vertex2, vertex3};
+                clipPolygon(m_polygon, m_clippedPolygon, true, clipRect->left, true);
+                clipPolygon(m_clippedPolygon, m_polygon, true, clipRight, false);
+                clipPolygon(m_polygon, m_clippedPolygon, false, clipRect->top, true);
+                clipPolygon(m_clippedPolygon, m_polygon, false, clipBottom, false);
+
+                for (std::size_t i = 2; i < m_polygon.size(); ++i)
+                {
+                    m_vertices.push_back(m_polygon[0]);
+                    m_vertices.push_back(m_polygon[i-1]);
+                    m_vertices.push_back(m_polygon[i]);
+                }
+
+                return;
+            }
+        }
+
+        m_vertices.push_back(vertex1);
+        m_vertices.push_back(vertex2);
+        m_vertices.push_back(vertex3);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PrimitiveBatch::drawCollectedVertices()
+    {
+        if (m_vertices.empty())
+            return;
+
+        // The view may have been changed since the vertices were added
+        const sf::View oldView = m_target->getView();
+        const bool viewChanged = !isSameView(oldView, m_view);
+        if (viewChanged)
+            m_target->setView(m_view);
+
+        m_target->draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::Triangles, {m_blendMode, sf::Transform::Identity, m_texture, nullptr});
+        m_vertices.clear();
+
+        if (viewChanged)
+            m_target->setView(oldView);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
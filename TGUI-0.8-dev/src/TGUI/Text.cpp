@@ -25,13 +25,81 @@
 
 #include <TGUI/Text.hpp>
 #include <TGUI/Global.hpp>
+#include <TGUI/PrimitiveBatch.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <algorithm>
 #include <cmath>
+#include <limits>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define TGUI_MEASURE_ASCII_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define TGUI_MEASURE_ASCII_SSE2
+#endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Longer texts are unlikely to be shown again and would take too much memory to cache
+        const std::size_t MaxCachedTextLength = 256;
+
+        Text::SizeCacheStatistics sizeCacheStatistics = {0, 0};
+
+        bool isPrintableAscii(std::uint32_t c)
+        {
+            return (c >= 32) && (c < 127);
+        }
+
+        float getAsciiCharWidth(std::uint32_t prevChar, std::uint32_t curChar, const float* advances, const float* kernings)
+        {
+            if (kernings)
+                return advances[curChar] + kernings[prevChar * 128 + curChar];
+            else
+                return advances[curChar];
+        }
+
+        // Returns the width of the characters between begin and end, which may not contain newlines
+        float measureWidth(const sf::String& text, std::size_t begin, std::size_t end, const Font& font, unsigned int textSize,
+                           bool bold, const float* asciiAdvances, const float* asciiKernings)
+        {
+            float width = 0;
+            std::uint32_t prevChar = 0;
+            std::size_t i = begin;
+            while (i < end)
+            {
+                if (prevChar < 128)
+                {
+                    const std::size_t count = Text::measureAsciiRun(text.getData() + i, end - i, prevChar, asciiAdvances, asciiKernings,
+                                                                    std::numeric_limits<float>::infinity(), width);
+                    if (count > 0)
+                    {
+                        i += count;
+                        prevChar = text[i - 1];
+                        continue;
+                    }
+                }
+
+                const std::uint32_t curChar = text[i];
+                if (curChar == '\t')
+                    width += font.getGlyph(' ', textSize, bold).advance * 4 + font.getKerning(prevChar, curChar, textSize);
+                else
+                    width += font.getGlyph(curChar, textSize, bold).advance + font.getKerning(prevChar, curChar, textSize);
+
+                prevChar = curChar;
+                ++i;
+            }
+
+            return width;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Vector2f Text::getSize() const
@@ -182,30 +250,60 @@ namespace tgui
                                          matrix[1], matrix[5], std::floor(matrix[13]),
                                          matrix[3], matrix[7], matrix[15]};
 
-        target.draw(m_text, states);
+        PrimitiveBatch::draw(target, m_text, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Text::recalculateSize()
     {
-        const std::shared_ptr<sf::Font> font = m_font;
-        if (font == nullptr)
+        if (m_font == nullptr)
         {
             m_size = {0, 0};
             return;
         }
 
+        // The same texts are often measured again, e.g. when widgets with the same caption are created
+        const sf::String& string = m_text.getString();
+        const bool cacheable = (string.getSize() <= MaxCachedTextLength);
+        if (cacheable)
+        {
+            sf::Vector2f cachedSize;
+            if (m_font.findCachedTextSize(string, m_text.getCharacterSize(), m_text.getStyle(), cachedSize))
+            {
+                sizeCacheStatistics.hits++;
+                m_size = cachedSize;
+                return;
+            }
+
+            sizeCacheStatistics.misses++;
+        }
+
         float width = 0;
         float maxWidth = 0;
         unsigned int lines = 1;
         std::uint32_t prevChar = 0;
-        const sf::String& string = m_text.getString();
         const bool bold = (m_text.getStyle() & sf::Text::Bold) != 0;
         const unsigned int textSize = m_text.getCharacterSize();
+        const float* asciiAdvances = m_font.getAsciiAdvances(textSize, bold);
+        const float* asciiKernings = m_font.getAsciiKernings(textSize);
         for (std::size_t i = 0; i < string.getSize(); ++i)
         {
-            const float kerning = font->getKerning(prevChar, string[i], textSize);
+            // Runs of printable ASCII characters are measured with a lookup table instead of glyph by glyph
+            if (prevChar < 128)
+            {
+                const std::size_t count = measureAsciiRun(string.getData() + i, string.getSize() - i, prevChar,
+                                                          asciiAdvances, asciiKernings, std::numeric_limits<float>::infinity(), width);
+                if (count > 0)
+                {
+                    i += count;
+                    prevChar = string[i - 1];
+                    if (i == string.getSize())
+                        break;
+                }
+            }
+
+            const float kerning = m_font.getKerning(prevChar, string[i], textSize);
             if (string[i] == '\n')
             {
                 maxWidth = std::max(maxWidth, width);
@@ -213,16 +311,19 @@ namespace tgui
                 lines++;
             }
             else if (string[i] == '\t')
-                width += (static_cast<float>(font->getGlyph(' ', textSize, bold).advance) * 4) + kerning;
+                width += (static_cast<float>(m_font.getGlyph(' ', textSize, bold).advance) * 4) + kerning;
             else
-                width += static_cast<float>(font->getGlyph(string[i], textSize, bold).advance) + kerning;
+                width += static_cast<float>(m_font.getGlyph(string[i], textSize, bold).advance) + kerning;
 
             prevChar = string[i];
         }
 
         const float extraVerticalSpace = Text::calculateExtraVerticalSpace(m_font, m_text.getCharacterSize(), m_text.getStyle());
-        const float height = lines * font->getLineSpacing(m_text.getCharacterSize()) + extraVerticalSpace;
+        const float height = lines * m_font.getLineSpacing(m_text.getCharacterSize()) + extraVerticalSpace;
         m_size = {std::max(maxWidth, width), height};
+
+        if (cacheable)
+            m_font.cacheTextSize(string, m_text.getCharacterSize(), m_text.getStyle(), m_size);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -263,9 +364,8 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int Text::findBestTextSize(Font fontWrapper, float height, int fit)
+    unsigned int Text::findBestTextSize(Font font, float height, int fit)
     {
-        const std::shared_ptr<sf::Font> font = fontWrapper.getFont();
         if (!font)
             return 0;
 
@@ -277,16 +377,16 @@ namespace tgui
             textSizes[i] = i + 1;
 
         const auto high = std::lower_bound(textSizes.begin(), textSizes.end(), height,
-                                           [&](unsigned int charSize, float h) { return font->getLineSpacing(charSize) + Text::calculateExtraVerticalSpace(font, charSize) < h; });
+                                           [&](unsigned int charSize, float h) { return font.getLineSpacing(charSize) + Text::calculateExtraVerticalSpace(font, charSize) < h; });
         if (high == textSizes.end())
             return static_cast<unsigned int>(height);
 
-        const float highLineSpacing = font->getLineSpacing(*high);
+        const float highLineSpacing = font.getLineSpacing(*high);
         if (highLineSpacing == height)
             return *high;
 
         const auto low = high - 1;
-        const float lowLineSpacing = font->getLineSpacing(*low);
+        const float lowLineSpacing = font.getLineSpacing(*low);
 
         if (fit < 0)
             return *low;
@@ -311,12 +411,11 @@ namespace tgui
         const bool bold = (style & sf::Text::Bold) != 0;
 
         // Calculate the height of the first line (char size = everything above baseline, height + top = part below baseline)
-        const float lineHeight = characterSize
-                                 + font.getFont()->getGlyph('g', characterSize, bold).bounds.height
-                                 + font.getFont()->getGlyph('g', characterSize, bold).bounds.top;
+        const sf::Glyph& glyph = font.getGlyph('g', characterSize, bold);
+        const float lineHeight = characterSize + glyph.bounds.height + glyph.bounds.top;
 
         // Get the line spacing sfml returns
-        const float lineSpacing = font.getFont()->getLineSpacing(characterSize);
+        const float lineSpacing = font.getLineSpacing(characterSize);
 
         // Calculate the offset of the text
         return lineHeight - lineSpacing;
@@ -329,84 +428,312 @@ namespace tgui
         if (font == nullptr)
             return "";
 
+        std::vector<WrappedLine> lines;
+        wordWrap(lines, maxWidth, text, font, textSize, bold, dropLeadingSpace);
+
+        // The lines are joined again, the newline characters of the original text are kept
         sf::String result;
+        for (std::size_t i = 0; i < lines.size(); ++i)
+        {
+            const std::size_t nextBegin = (i + 1 < lines.size()) ? lines[i + 1].begin : text.getSize();
+            result += text.substring(lines[i].begin, nextBegin - lines[i].begin);
+            if ((i + 1 < lines.size()) && (text[nextBegin - 1] != '\n'))
+                result += "\n";
+        }
+
+        return result;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Text::wordWrap(std::vector<WrappedLine>& lines, float maxWidth, const sf::String& text, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace)
+    {
+        lines.clear();
+        if (font == nullptr)
+            return;
+
         std::size_t index = 0;
         while (index < text.getSize())
         {
-            const std::size_t oldIndex = index;
+            lines.push_back(wordWrapLine(maxWidth, text, index, font, textSize, bold, dropLeadingSpace));
 
-            // Find out how many characters we can get on this line
-            float width = 0;
-            std::uint32_t prevChar = 0;
-            for (std::size_t i = index; i < text.getSize(); ++i)
-            {
-                float charWidth;
-                const std::uint32_t curChar = text[i];
-                if (curChar == '\n')
-                {
-                    index++;
-                    break;
-                }
-                else if (curChar == '\t')
-                    charWidth = font.getFont()->getGlyph(' ', textSize, bold).advance * 4;
-                else
-                    charWidth = font.getFont()->getGlyph(curChar, textSize, bold).advance;
+            index = lines.back().end;
+            if ((index < text.getSize()) && (text[index] == '\n'))
+                index++;
+        }
+
+        // Like when splitting a string on its newlines, there is an empty line at the end when the text ends with a newline
+        if (text.isEmpty() || (text[text.getSize()-1] == '\n'))
+            lines.push_back({text.getSize(), text.getSize(), 0});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                const float kerning = font.getFont()->getKerning(prevChar, curChar, textSize);
-                if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
+    Text::WrappedLine Text::wordWrapLine(float maxWidth, const sf::String& text, std::size_t begin, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace)
+    {
+        if ((font == nullptr) || (begin >= text.getSize()))
+            return {begin, begin, 0};
+
+        const float* asciiAdvances = font.getAsciiAdvances(textSize, bold);
+        const float* asciiKernings = font.getAsciiKernings(textSize);
+        const float asciiMaxWidth = (maxWidth == 0) ? std::numeric_limits<float>::infinity() : maxWidth;
+
+        const std::size_t oldIndex = begin;
+        std::size_t index = begin;
+
+        // Find out how many characters we can get on this line
+        float width = 0;
+        std::uint32_t prevChar = 0;
+        for (std::size_t i = index; i < text.getSize(); ++i)
+        {
+            // Runs of printable ASCII characters are measured with a lookup table instead of glyph by glyph
+            if (prevChar < 128)
+            {
+                const std::size_t count = measureAsciiRun(text.getData() + i, text.getSize() - i, prevChar,
+                                                          asciiAdvances, asciiKernings, asciiMaxWidth, width);
+                if (count > 0)
                 {
-                    width += kerning + charWidth;
-                    index++;
+                    i += count;
+                    index += count;
+                    prevChar = text[i - 1];
+                    if (i == text.getSize())
+                        break;
                 }
-                else
-                    break;
+            }
 
-                prevChar = curChar;
+            float charWidth;
+            const std::uint32_t curChar = text[i];
+            if (curChar == '\n')
+            {
+                index++;
+                break;
             }
+            else if (curChar == '\t')
+                charWidth = font.getGlyph(' ', textSize, bold).advance * 4;
+            else
+                charWidth = font.getGlyph(curChar, textSize, bold).advance;
 
-            // Every line contains at least one character
-            if (index == oldIndex)
+            const float kerning = font.getKerning(prevChar, curChar, textSize);
+            if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
+            {
+                width += kerning + charWidth;
                 index++;
+            }
+            else
+                break;
+
+            prevChar = curChar;
+        }
+
+        // The width was measured up to this point, it has to be measured again when the end of the line changes below
+        const std::size_t measuredEnd = ((index > oldIndex) && (text[index-1] == '\n')) ? index - 1 : index;
+
+        // Every line contains at least one character
+        if (index == oldIndex)
+            index++;
 
-            // Implement the word-wrap by removing the last few characters from the line
-            if (text[index-1] != '\n')
+        // Implement the word-wrap by removing the last few characters from the line
+        if (text[index-1] != '\n')
+        {
+            const std::size_t indexWithoutWordWrap = index;
+            if ((index < text.getSize()) && (!isWhitespace(text[index])))
             {
-                const std::size_t indexWithoutWordWrap = index;
-                if ((index < text.getSize()) && (!isWhitespace(text[index])))
+                std::size_t wordWrapCorrection = 0;
+                while ((index > oldIndex) && (!isWhitespace(text[index - 1])))
                 {
-                    std::size_t wordWrapCorrection = 0;
-                    while ((index > oldIndex) && (!isWhitespace(text[index - 1])))
-                    {
-                        wordWrapCorrection++;
-                        index--;
-                    }
-
-                    // The word can't be split but there is no other choice, it does not fit on the line
-                    if ((index - oldIndex) <= wordWrapCorrection)
-                        index = indexWithoutWordWrap;
+                    wordWrapCorrection++;
+                    index--;
                 }
+
+                // The word can't be split but there is no other choice, it does not fit on the line
+                if ((index - oldIndex) <= wordWrapCorrection)
+                    index = indexWithoutWordWrap;
             }
+        }
 
-            // If the next line starts with just a space, then the space need not be visible
-            if (dropLeadingSpace)
+        // If the next line starts with just a space, then the space need not be visible
+        if (dropLeadingSpace)
+        {
+            if ((index < text.getSize()) && (text[index] == ' '))
             {
-                if ((index < text.getSize()) && (text[index] == ' '))
+                if ((index == 0) || (!isWhitespace(text[index-1])))
                 {
-                    if ((index == 0) || (!isWhitespace(text[index-1])))
-                    {
-                        // But two or more spaces indicate that it is not a normal text and the spaces should not be ignored
-                        if (((index + 1 < text.getSize()) && (!isWhitespace(text[index + 1]))) || (index + 1 == text.getSize()))
-                            index++;
-                    }
+                    // But two or more spaces indicate that it is not a normal text and the spaces should not be ignored
+                    if (((index + 1 < text.getSize()) && (!isWhitespace(text[index + 1]))) || (index + 1 == text.getSize()))
+                        index++;
                 }
             }
+        }
 
-            result += text.substring(oldIndex, index - oldIndex);
-            if ((index < text.getSize()) && (text[index-1] != '\n'))
-                result += "\n";
+        const std::size_t lineEnd = (text[index-1] == '\n') ? index - 1 : index;
+        if (lineEnd != measuredEnd)
+            width = measureWidth(text, oldIndex, lineEnd, font, textSize, bold, asciiAdvances, asciiKernings);
+
+        return {oldIndex, lineEnd, width};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Text::SizeCacheStatistics Text::getSizeCacheStatistics()
+    {
+        return sizeCacheStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Text::resetSizeCacheStatistics()
+    {
+        sizeCacheStatistics = {0, 0};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Text::calculateCharacterPositions(std::vector<float>& positions, const sf::String& text, Font font, unsigned int textSize, bool bold)
+    {
+        if (font == nullptr)
+        {
+            positions.assign(text.getSize() + 1, 0);
+            return;
         }
 
-        return result;
+        positions.resize(text.getSize() + 1);
+        positions[0] = 0;
+
+        const float* asciiAdvances = font.getAsciiAdvances(textSize, bold);
+        const float* asciiKernings = font.getAsciiKernings(textSize);
+
+        float x = 0;
+        std::uint32_t prevChar = 0;
+        for (std::size_t i = 0; i < text.getSize(); ++i)
+        {
+            const std::uint32_t curChar = text[i];
+            if ((prevChar < 128) && isPrintableAscii(curChar))
+                x += getAsciiCharWidth(prevChar, curChar, asciiAdvances, asciiKernings);
+            else if (curChar == '\t')
+                x += font.getGlyph(' ', textSize, bold).advance * 4 + font.getKerning(prevChar, curChar, textSize);
+            else if (curChar != '\n')
+                x += font.getGlyph(curChar, textSize, bold).advance + font.getKerning(prevChar, curChar, textSize);
+
+            positions[i + 1] = x;
+            prevChar = curChar;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Text::findCharacterIndex(const std::vector<float>& positions, float x)
+    {
+        if (positions.empty())
+            return 0;
+
+        const auto it = std::lower_bound(positions.begin(), positions.end(), x);
+        if (it == positions.begin())
+            return 0;
+        if (it == positions.end())
+            return positions.size() - 1;
+
+        // Place the caret on the side of the character that is closest to the position
+        const std::size_t index = static_cast<std::size_t>(it - positions.begin());
+        if (x - positions[index - 1] < positions[index] - x)
+            return index - 1;
+        else
+            return index;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Text::measureAsciiRun(const sf::Uint32* text, std::size_t count, std::uint32_t prevChar,
+                                      const float* advances, const float* kernings, float maxWidth, float& width)
+    {
+        // The first character is handled separately so that the vectorized loop can take the previous characters from the text
+        if ((count == 0) || !isPrintableAscii(text[0]))
+            return 0;
+
+        const float firstWidth = getAsciiCharWidth(prevChar, text[0], advances, kernings);
+        if (width + firstWidth > maxWidth)
+            return 0;
+
+        width += firstWidth;
+        std::size_t i = 1;
+
+#if defined(TGUI_MEASURE_ASCII_AVX2)
+        // Eight characters at a time. Blocks that contain a character that isn't printable ASCII or that would exceed
+        // the maximum width are left to the scalar loop below, which finds the exact character to stop at.
+        const __m256i lowerBound = _mm256_set1_epi32(31);
+        const __m256i upperBound = _mm256_set1_epi32(127);
+        while (i + 8 <= count)
+        {
+            const __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
+            const __m256i printable = _mm256_and_si256(_mm256_cmpgt_epi32(chars, lowerBound), _mm256_cmpgt_epi32(upperBound, chars));
+            if (_mm256_movemask_ps(_mm256_castsi256_ps(printable)) != 0xFF)
+                break;
+
+            __m256 widths = _mm256_i32gather_ps(advances, chars, 4);
+            if (kernings)
+            {
+                const __m256i prevChars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i - 1));
+                const __m256i pairs = _mm256_add_epi32(_mm256_slli_epi32(prevChars, 7), chars);
+                widths = _mm256_add_ps(widths, _mm256_i32gather_ps(kernings, pairs, 4));
+            }
+
+            // Inclusive prefix sum within both halves, after which the total of the lower half is added to the upper half
+            widths = _mm256_add_ps(widths, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(widths), 4)));
+            widths = _mm256_add_ps(widths, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(widths), 8)));
+            const __m128 lowerHalf = _mm256_castps256_ps128(widths);
+            const __m128 lowerTotal = _mm_shuffle_ps(lowerHalf, lowerHalf, _MM_SHUFFLE(3, 3, 3, 3));
+            widths = _mm256_add_ps(widths, _mm256_insertf128_ps(_mm256_setzero_ps(), lowerTotal, 1));
+
+            const __m256 totals = _mm256_add_ps(widths, _mm256_set1_ps(width));
+            if (_mm256_movemask_ps(_mm256_cmp_ps(totals, _mm256_set1_ps(maxWidth), _CMP_GT_OQ)) != 0)
+                break;
+
+            const __m128 upperHalf = _mm256_extractf128_ps(totals, 1);
+            width = _mm_cvtss_f32(_mm_shuffle_ps(upperHalf, upperHalf, _MM_SHUFFLE(3, 3, 3, 3)));
+            i += 8;
+        }
+#elif defined(TGUI_MEASURE_ASCII_SSE2)
+        // Four characters at a time. Blocks that contain a character that isn't printable ASCII or that would exceed
+        // the maximum width are left to the scalar loop below, which finds the exact character to stop at.
+        const __m128i lowerBound = _mm_set1_epi32(31);
+        const __m128i upperBound = _mm_set1_epi32(127);
+        while (i + 4 <= count)
+        {
+            const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+            const __m128i printable = _mm_and_si128(_mm_cmpgt_epi32(chars, lowerBound), _mm_cmplt_epi32(chars, upperBound));
+            if (_mm_movemask_ps(_mm_castsi128_ps(printable)) != 0xF)
+                break;
+
+            // SSE2 has no gather instruction, the table lookups remain scalar
+            __m128 widths = _mm_set_ps(getAsciiCharWidth(text[i + 2], text[i + 3], advances, kernings),
+                                       getAsciiCharWidth(text[i + 1], text[i + 2], advances, kernings),
+                                       getAsciiCharWidth(text[i], text[i + 1], advances, kernings),
+                                       getAsciiCharWidth(text[i - 1], text[i], advances, kernings));
+
+            widths = _mm_add_ps(widths, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(widths), 4)));
+            widths = _mm_add_ps(widths, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(widths), 8)));
+
+            const __m128 totals = _mm_add_ps(widths, _mm_set1_ps(width));
+            if (_mm_movemask_ps(_mm_cmpgt_ps(totals, _mm_set1_ps(maxWidth))) != 0)
+                break;
+
+            width = _mm_cvtss_f32(_mm_shuffle_ps(totals, totals, _MM_SHUFFLE(3, 3, 3, 3)));
+            i += 4;
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            if (!isPrintableAscii(text[i]))
+                break;
+
+            const float charWidth = getAsciiCharWidth(text[i - 1], text[i], advances, kernings);
+            if (width + charWidth > maxWidth)
+                break;
+
+            width += charWidth;
+        }
+
+        return i;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
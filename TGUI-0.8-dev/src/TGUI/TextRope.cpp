@@ -0,0 +1,677 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/TextRope.hpp>
+#include <algorithm>
+#include <cassert>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Chunks are never made larger than this, so that inserting or erasing inside a chunk stays cheap
+        const std::size_t maxChunkSize = 1024;
+
+        // Chunks that become smaller than this while editing are combined with a neighbouring chunk when possible
+        const std::size_t minChunkSize = maxChunkSize / 4;
+
+        std::size_t countNewlines(const std::uint32_t* begin, const std::uint32_t* end)
+        {
+            return static_cast<std::size_t>(std::count(begin, end, static_cast<std::uint32_t>('\n')));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct TextRope::Node
+    {
+        std::vector<std::uint32_t> chunk;
+        std::size_t chunkNewlines = 0;
+
+        // Totals of this node and all its descendants
+        std::size_t size = 0;
+        std::size_t newlines = 0;
+
+        std::uint32_t priority = 0;
+        std::unique_ptr<Node> left;
+        std::unique_ptr<Node> right;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace
+    {
+        template <typename NodePtr>
+        std::size_t getSubtreeSize(const NodePtr& node)
+        {
+            return node ? node->size : 0;
+        }
+
+        template <typename NodePtr>
+        std::size_t getSubtreeNewlines(const NodePtr& node)
+        {
+            return node ? node->newlines : 0;
+        }
+
+        template <typename NodeType>
+        const NodeType& getFirstNode(const NodeType& node)
+        {
+            const NodeType* first = &node;
+            while (first->left)
+                first = first->left.get();
+
+            return *first;
+        }
+
+        template <typename NodeType>
+        const NodeType& getLastNode(const NodeType& node)
+        {
+            const NodeType* last = &node;
+            while (last->right)
+                last = last->right.get();
+
+            return *last;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextRope::TextRope() = default;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextRope::TextRope(const sf::String& text)
+    {
+        m_root = build(text.getData(), text.getSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextRope::TextRope(const TextRope& other) :
+        m_root        {clone(other.m_root.get())},
+        m_randomState {other.m_randomState}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextRope::TextRope(TextRope&& other) noexcept = default;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextRope::~TextRope() = default;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextRope& TextRope::operator=(const TextRope& other)
+    {
+        if (this != &other)
+        {
+            m_root = clone(other.m_root.get());
+            m_randomState = other.m_randomState;
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextRope& TextRope::operator=(TextRope&& other) noexcept = default;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextRope::getSize() const
+    {
+        return getSubtreeSize(m_root);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextRope::isEmpty() const
+    {
+        return getSize() == 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint32_t TextRope::operator[](std::size_t index) const
+    {
+        assert(index < getSize());
+
+        const Node* node = m_root.get();
+        while (node)
+        {
+            const std::size_t leftSize = getSubtreeSize(node->left);
+            if (index < leftSize)
+                node = node->left.get();
+            else if (index < leftSize + node->chunk.size())
+                return node->chunk[index - leftSize];
+            else
+            {
+                index -= leftSize + node->chunk.size();
+                node = node->right.get();
+            }
+        }
+
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextRope::insert(std::size_t position, const sf::String& text)
+    {
+        insert(position, text.getData(), text.getSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextRope::insert(std::size_t position, std::uint32_t character)
+    {
+        insert(position, &character, 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextRope::insert(std::size_t position, const std::uint32_t* characters, std::size_t count)
+    {
+        assert(position <= getSize());
+        if (count == 0)
+            return;
+
+        // Find the chunk in which the characters would be inserted
+        const Node* node = m_root.get();
+        std::size_t offset = position;
+        while (node)
+        {
+            const std::size_t leftSize = getSubtreeSize(node->left);
+            if (offset < leftSize)
+                node = node->left.get();
+            else if (offset <= leftSize + node->chunk.size())
+                break;
+            else
+            {
+                offset -= leftSize + node->chunk.size();
+                node = node->right.get();
+            }
+        }
+
+        // When the characters fit in the chunk then they are inserted directly, the totals of all nodes on the path to the
+        // chunk are updated while following the same path again
+        if (node && (node->chunk.size() + count <= maxChunkSize))
+        {
+            const std::size_t newlines = countNewlines(characters, characters + count);
+
+            Node* pathNode = m_root.get();
+            offset = position;
+            while (true)
+            {
+                pathNode->size += count;
+                pathNode->newlines += newlines;
+
+                const std::size_t leftSize = getSubtreeSize(pathNode->left);
+                if (offset < leftSize)
+                    pathNode = pathNode->left.get();
+                else if (offset <= leftSize + pathNode->chunk.size())
+                {
+                    pathNode->chunk.insert(pathNode->chunk.begin() + (offset - leftSize), characters, characters + count);
+                    pathNode->chunkNewlines += newlines;
+                    return;
+                }
+                else
+                {
+                    offset -= leftSize + pathNode->chunk.size();
+                    pathNode = pathNode->right.get();
+                }
+            }
+        }
+
+        // Otherwise the tree is split at the position and new chunks are placed in between
+        std::unique_ptr<Node> left;
+        std::unique_ptr<Node> right;
+        split(std::move(m_root), position, left, right);
+        m_root = concatenate(concatenate(std::move(left), build(characters, count)), std::move(right));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextRope::erase(std::size_t position, std::size_t count)
+    {
+        const std::size_t size = getSize();
+        if (position >= size)
+            return;
+
+        count = std::min(count, size - position);
+        if (count == 0)
+            return;
+
+        // Find the chunk containing the first character that is erased
+        const Node* node = m_root.get();
+        std::size_t offset = position;
+        while (node)
+        {
+            const std::size_t leftSize = getSubtreeSize(node->left);
+            if (offset < leftSize)
+                node = node->left.get();
+            else if (offset < leftSize + node->chunk.size())
+            {
+                offset -= leftSize;
+                break;
+            }
+            else
+            {
+                offset -= leftSize + node->chunk.size();
+                node = node->right.get();
+            }
+        }
+
+        // When only part of a single chunk is erased then the characters are removed from it directly, unless the chunk
+        // would become so small that it should be combined with a neighbouring chunk
+        if (node && (offset + count <= node->chunk.size()) && (count < node->chunk.size())
+         && ((node->chunk.size() - count >= minChunkSize) || (node->chunk.size() == m_root->size)))
+        {
+            const std::size_t newlines = countNewlines(node->chunk.data() + offset, node->chunk.data() + offset + count);
+
+            Node* pathNode = m_root.get();
+            offset = position;
+            while (true)
+            {
+                pathNode->size -= count;
+                pathNode->newlines -= newlines;
+
+                const std::size_t leftSize = getSubtreeSize(pathNode->left);
+                if (offset < leftSize)
+                    pathNode = pathNode->left.get();
+                else if (offset < leftSize + pathNode->chunk.size())
+                {
+                    const auto first = pathNode->chunk.begin() + (offset - leftSize);
+                    pathNode->chunk.erase(first, first + count);
+                    pathNode->chunkNewlines -= newlines;
+                    return;
+                }
+                else
+                {
+                    offset -= leftSize + pathNode->chunk.size();
+                    pathNode = pathNode->right.get();
+                }
+            }
+        }
+
+        // Otherwise the erased part is cut out of the tree
+        std::unique_ptr<Node> left;
+        std::unique_ptr<Node> middle;
+        std::unique_ptr<Node> right;
+        split(std::move(m_root), position, left, middle);
+        split(std::move(middle), count, middle, right);
+        m_root = concatenate(std::move(left), std::move(right));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String TextRope::substring(std::size_t position, std::size_t length) const
+    {
+        const std::size_t size = getSize();
+        if (position >= size)
+            return "";
+
+        length = std::min(length, size - position);
+
+        std::vector<std::uint32_t> characters;
+        characters.reserve(length);
+        appendRange(m_root.get(), position, position + length, characters);
+        return sf::String::fromUtf32(characters.begin(), characters.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String TextRope::toString() const
+    {
+        return substring(0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextRope::getLineCount() const
+    {
+        return getSubtreeNewlines(m_root) + 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextRope::getLineIndex(std::size_t position) const
+    {
+        std::size_t newlines = 0;
+        const Node* node = m_root.get();
+        while (node)
+        {
+            const std::size_t leftSize = getSubtreeSize(node->left);
+            if (position <= leftSize)
+                node = node->left.get();
+            else if (position <= leftSize + node->chunk.size())
+            {
+                const std::uint32_t* chunk = node->chunk.data();
+                return newlines + getSubtreeNewlines(node->left) + countNewlines(chunk, chunk + (position - leftSize));
+            }
+            else
+            {
+                newlines += getSubtreeNewlines(node->left) + node->chunkNewlines;
+                position -= leftSize + node->chunk.size();
+                node = node->right.get();
+            }
+        }
+
+        return newlines;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextRope::getLineStart(std::size_t line) const
+    {
+        if (line == 0)
+            return 0;
+        if (line > getSubtreeNewlines(m_root))
+            return getSize();
+
+        // Search the newline in front of the line
+        std::size_t position = 0;
+        const Node* node = m_root.get();
+        while (node)
+        {
+            const std::size_t leftNewlines = getSubtreeNewlines(node->left);
+            if (line <= leftNewlines)
+            {
+                node = node->left.get();
+                continue;
+            }
+
+            line -= leftNewlines;
+            position += getSubtreeSize(node->left);
+            if (line <= node->chunkNewlines)
+            {
+                for (std::size_t i = 0; i < node->chunk.size(); ++i)
+                {
+                    if ((node->chunk[i] == '\n') && (--line == 0))
+                        return position + i + 1;
+                }
+            }
+
+            line -= node->chunkNewlines;
+            position += node->chunk.size();
+            node = node->right.get();
+        }
+
+        return getSize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextRope::updateNode(Node& node)
+    {
+        node.size = getSubtreeSize(node.left) + node.chunk.size() + getSubtreeSize(node.right);
+        node.newlines = getSubtreeNewlines(node.left) + node.chunkNewlines + getSubtreeNewlines(node.right);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextRope::split(std::unique_ptr<Node> node, std::size_t position, std::unique_ptr<Node>& left, std::unique_ptr<Node>& right)
+    {
+        if (!node)
+        {
+            left = nullptr;
+            right = nullptr;
+            return;
+        }
+
+        const std::size_t leftSize = getSubtreeSize(node->left);
+        if (position <= leftSize)
+        {
+            std::unique_ptr<Node> rightOfLeft;
+            split(std::move(node->left), position, left, rightOfLeft);
+            node->left = std::move(rightOfLeft);
+            updateNode(*node);
+            right = std::move(node);
+        }
+        else if (position >= leftSize + node->chunk.size())
+        {
+            std::unique_ptr<Node> leftOfRight;
+            split(std::move(node->right), position - leftSize - node->chunk.size(), leftOfRight, right);
+            node->right = std::move(leftOfRight);
+            updateNode(*node);
+            left = std::move(node);
+        }
+        else // The position lies inside the chunk of this node, so the chunk is split in two
+        {
+            const auto splitPos = node->chunk.begin() + (position - leftSize);
+
+            std::unique_ptr<Node> tail = std::make_unique<Node>();
+            tail->chunk.assign(splitPos, node->chunk.end());
+            tail->chunkNewlines = countNewlines(tail->chunk.data(), tail->chunk.data() + tail->chunk.size());
+            tail->priority = node->priority;
+            updateNode(*tail);
+
+            node->chunk.erase(splitPos, node->chunk.end());
+            node->chunkNewlines -= tail->chunkNewlines;
+
+            right = merge(std::move(tail), std::move(node->right));
+            updateNode(*node);
+            left = std::move(node);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<TextRope::Node> TextRope::merge(std::unique_ptr<Node> left, std::unique_ptr<Node> right)
+    {
+        if (!left)
+            return right;
+        if (!right)
+            return left;
+
+        if (left->priority > right->priority)
+        {
+            left->right = merge(std::move(left->right), std::move(right));
+            updateNode(*left);
+            return left;
+        }
+        else
+        {
+            right->left = merge(std::move(left), std::move(right->left));
+            updateNode(*right);
+            return right;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<TextRope::Node> TextRope::concatenate(std::unique_ptr<Node> left, std::unique_ptr<Node> right)
+    {
+        joinChunksAtSeam(left, right);
+
+        // A chunk at the seam that is still small is combined with the chunk on its other side when possible. Otherwise
+        // splitting chunks while editing would leave more and more small chunks behind.
+        if (left && (getLastNode(*left).chunk.size() < minChunkSize))
+        {
+            std::unique_ptr<Node> last = takeLastNode(left);
+            joinChunksAtSeam(left, last);
+            left = merge(std::move(left), std::move(last));
+            joinChunksAtSeam(left, right);
+        }
+
+        if (right && (getFirstNode(*right).chunk.size() < minChunkSize))
+        {
+            std::unique_ptr<Node> first = takeFirstNode(right);
+            joinChunksAtSeam(first, right);
+            right = merge(std::move(first), std::move(right));
+        }
+
+        return merge(std::move(left), std::move(right));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextRope::joinChunksAtSeam(std::unique_ptr<Node>& left, std::unique_ptr<Node>& right)
+    {
+        if (!left || !right)
+            return;
+
+        if (getLastNode(*left).chunk.size() + getFirstNode(*right).chunk.size() > maxChunkSize)
+            return;
+
+        const std::unique_ptr<Node> first = takeFirstNode(right);
+        appendToLastChunk(*left, *first);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<TextRope::Node> TextRope::takeFirstNode(std::unique_ptr<Node>& node)
+    {
+        if (node->left)
+        {
+            std::unique_ptr<Node> first = takeFirstNode(node->left);
+            updateNode(*node);
+            return first;
+        }
+
+        // The node is replaced by its right subtree
+        std::unique_ptr<Node> first = std::move(node);
+        node = std::move(first->right);
+        updateNode(*first);
+        return first;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<TextRope::Node> TextRope::takeLastNode(std::unique_ptr<Node>& node)
+    {
+        if (node->right)
+        {
+            std::unique_ptr<Node> last = takeLastNode(node->right);
+            updateNode(*node);
+            return last;
+        }
+
+        // The node is replaced by its left subtree
+        std::unique_ptr<Node> last = std::move(node);
+        node = std::move(last->left);
+        updateNode(*last);
+        return last;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextRope::appendToLastChunk(Node& node, const Node& source)
+    {
+        if (node.right)
+            appendToLastChunk(*node.right, source);
+        else
+        {
+            node.chunk.insert(node.chunk.end(), source.chunk.begin(), source.chunk.end());
+            node.chunkNewlines += source.chunkNewlines;
+        }
+
+        updateNode(node);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<TextRope::Node> TextRope::clone(const Node* node)
+    {
+        if (!node)
+            return nullptr;
+
+        auto copy = std::make_unique<Node>();
+        copy->chunk = node->chunk;
+        copy->chunkNewlines = node->chunkNewlines;
+        copy->size = node->size;
+        copy->newlines = node->newlines;
+        copy->priority = node->priority;
+        copy->left = clone(node->left.get());
+        copy->right = clone(node->right.get());
+        return copy;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextRope::appendRange(const Node* node, std::size_t begin, std::size_t end, std::vector<std::uint32_t>& output)
+    {
+        if (!node || (begin >= end))
+            return;
+
+        const std::size_t leftSize = getSubtreeSize(node->left);
+        const std::size_t chunkEnd = leftSize + node->chunk.size();
+
+        if (begin < leftSize)
+            appendRange(node->left.get(), begin, std::min(end, leftSize), output);
+
+        if ((begin < chunkEnd) && (end > leftSize))
+        {
+            const std::size_t first = std::max(begin, leftSize) - leftSize;
+            const std::size_t last = std::min(end, chunkEnd) - leftSize;
+            output.insert(output.end(), node->chunk.begin() + first, node->chunk.begin() + last);
+        }
+
+        if (end > chunkEnd)
+            appendRange(node->right.get(), (begin > chunkEnd) ? begin - chunkEnd : 0, end - chunkEnd, output);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<TextRope::Node> TextRope::build(const std::uint32_t* characters, std::size_t count)
+    {
+        // The chunks are only filled halfway, so that there is still room for typing in them
+        std::unique_ptr<Node> root;
+        for (std::size_t i = 0; i < count; i += maxChunkSize / 2)
+        {
+            const std::size_t chunkSize = std::min(maxChunkSize / 2, count - i);
+
+            auto node = std::make_unique<Node>();
+            node->chunk.assign(characters + i, characters + i + chunkSize);
+            node->chunkNewlines = countNewlines(characters + i, characters + i + chunkSize);
+            node->priority = generatePriority();
+            updateNode(*node);
+
+            root = merge(std::move(root), std::move(node));
+        }
+
+        return root;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint32_t TextRope::generatePriority()
+    {
+        // Xorshift random number generator
+        m_randomState ^= m_randomState << 13;
+        m_randomState ^= m_randomState >> 17;
+        m_randomState ^= m_randomState << 5;
+        return m_randomState;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -181,9 +181,14 @@ namespace tgui
         m_data = nullptr;
         auto data = std::make_shared<TextureData>();
         if (partRect == sf::IntRect{})
-            data->texture = texture;
+            data->texture = std::make_shared<sf::Texture>(texture);
         else
-            data->texture.loadFromImage(texture.copyToImage(), partRect);
+        {
+            data->texture = std::make_shared<sf::Texture>();
+            data->texture->loadFromImage(texture.copyToImage(), partRect);
+        }
+
+        data->textureRect = {0, 0, static_cast<int>(data->texture->getSize().x), static_cast<int>(data->texture->getSize().y)};
 
         m_id = "";
         setTextureData(data, middleRect);
@@ -208,7 +213,7 @@ namespace tgui
     Vector2f Texture::getImageSize() const
     {
         if (m_data)
-            return sf::Vector2f{m_data->texture.getSize()};
+            return {static_cast<float>(m_data->textureRect.width), static_cast<float>(m_data->textureRect.height)};
         else
             return {0,0};
     }
@@ -217,8 +222,29 @@ namespace tgui
 
     void Texture::setSmooth(bool smooth)
     {
-        if (m_data)
-            m_data->texture.setSmooth(smooth);
+        if (!m_data || (m_data->texture->isSmooth() == smooth))
+            return;
+
+        // When the texture is shared with other images, the image gets a texture of its own. Otherwise the filter would
+        // also be applied to the other images and the neighbouring pixels in the atlas would bleed into this image.
+        // The texture data is shared by all textures that use the same part of the image and sprites may already have been
+        // positioned on it, so this texture switches to other data instead of changing the existing data.
+        const sf::Vector2u textureSize = m_data->texture->getSize();
+        if (m_data->holder && ((m_data->texture.use_count() > 1)
+         || (m_data->textureRect != sf::IntRect{0, 0, static_cast<int>(textureSize.x), static_cast<int>(textureSize.y)})))
+        {
+            const auto destructCallback = m_destructCallback;
+            const auto data = TextureManager::getSeparateTexture(*this, m_data);
+            if (!data)
+                return;
+
+            if (destructCallback != nullptr)
+                destructCallback(m_data);
+
+            m_data = data;
+        }
+
+        m_data->texture->setSmooth(smooth);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -226,7 +252,7 @@ namespace tgui
     bool Texture::isSmooth() const
     {
         if (m_data)
-            return m_data->texture.isSmooth();
+            return m_data->texture->isSmooth();
         else
             return false;
     }
@@ -260,10 +286,13 @@ namespace tgui
 
     bool Texture::isTransparentPixel(sf::Vector2u pixel) const
     {
-        if (!m_data || !m_data->image)
+        if (!m_data || (m_data->opacityMask.empty() && !m_data->image))
             return false;
 
-        assert(pixel.x < m_data->texture.getSize().x && pixel.y < m_data->texture.getSize().y);
+        assert(pixel.x < static_cast<unsigned int>(m_data->textureRect.width) && pixel.y < static_cast<unsigned int>(m_data->textureRect.height));
+
+        if (!m_data->opacityMask.empty())
+            return !m_data->opacityMask[static_cast<std::size_t>(pixel.y) * m_data->textureRect.width + pixel.x];
 
         if (m_data->image->getPixel(pixel.x + m_data->rect.left, pixel.y + m_data->rect.top).a == 0)
             return true;
@@ -342,7 +371,7 @@ namespace tgui
         m_data = data;
 
         if (middleRect == sf::IntRect{})
-            m_middleRect = {0, 0, static_cast<int>(m_data->texture.getSize().x), static_cast<int>(m_data->texture.getSize().y)};
+            m_middleRect = {0, 0, m_data->textureRect.width, m_data->textureRect.height};
         else
             m_middleRect = middleRect;
     }
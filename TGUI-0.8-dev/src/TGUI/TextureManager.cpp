@@ -27,74 +27,128 @@
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Exception.hpp>
 
+#include <functional>
+#include <algorithm>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
-    std::map<std::string, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    namespace
+    {
+        // Images of which neither side is larger than this are packed together in atlas pages
+        const unsigned int AtlasMaxImageSize = 256;
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const unsigned int AtlasPageSize = 1024;
 
-    std::shared_ptr<TextureData> TextureManager::getTexture(Texture& texture, const std::string& filename, const sf::IntRect& partRect)
-    {
-        // Look if we already had this image
-        auto imageIt = m_imageMap.find(filename);
-        if (imageIt != m_imageMap.end())
+        // Empty space that is left between images in an atlas page
+        const unsigned int AtlasPadding = 1;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the part of the image that is loaded, clamped in the same way as sf::Texture::loadFromImage does it
+        sf::IntRect getImagePart(sf::Vector2u imageSize, sf::IntRect rect)
         {
-            // Loop all our textures to find the one containing the image
-            for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
+            if ((rect.width <= 0) || (rect.height <= 0))
+                return {0, 0, static_cast<int>(imageSize.x), static_cast<int>(imageSize.y)};
+
+            rect.left = std::max(0, std::min(rect.left, static_cast<int>(imageSize.x)));
+            rect.top = std::max(0, std::min(rect.top, static_cast<int>(imageSize.y)));
+            rect.width = std::min(rect.width, static_cast<int>(imageSize.x) - rect.left);
+            rect.height = std::min(rect.height, static_cast<int>(imageSize.y) - rect.top);
+            return rect;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Stores for each pixel in the loaded part of the image whether it is visible, so that the image isn't needed to
+        // find out which pixels are transparent.
+        void createOpacityMask(TextureData& data)
+        {
+            const sf::Vector2u imageSize = data.image->getSize();
+            const sf::IntRect area = getImagePart(imageSize, data.rect);
+            if ((area.width <= 0) || (area.height <= 0))
+                return;
+
+            const sf::Uint8* pixels = data.image->getPixelsPtr();
+            data.opacityMask.resize(static_cast<std::size_t>(area.width) * area.height);
+            for (int y = 0; y < area.height; ++y)
             {
-                // Only reuse the texture when the exact same part of the image is used
-                if (dataIt->data->rect == partRect)
-                {
-                    // The texture is now used at multiple places
-                    ++(dataIt->users);
-
-                    // Let the texture alert the texture manager when it is being copied or destroyed
-                    texture.setCopyCallback(&TextureManager::copyTexture);
-                    texture.setDestructCallback(&TextureManager::removeTexture);
-                    return dataIt->data;
-                }
+                const sf::Uint8* row = pixels + 4 * ((static_cast<std::size_t>(area.top + y) * imageSize.x) + area.left);
+                for (int x = 0; x < area.width; ++x)
+                    data.opacityMask[static_cast<std::size_t>(y) * area.width + x] = (row[4 * x + 3] != 0);
             }
         }
-        else // The image doesn't exist yet
+    }
+
+    std::unordered_map<TextureManager::ImageKey, TextureDataHolder, TextureManager::ImageKeyHash> TextureManager::m_imageMap;
+    std::unordered_map<std::string, TextureManager::SharedImage> TextureManager::m_sharedImages;
+    std::vector<TextureManager::AtlasPage> TextureManager::m_atlasPages;
+    bool TextureManager::m_atlasEnabled = false;
+    bool TextureManager::m_keepImagesInMemory = false;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<TextureData> TextureManager::getTexture(Texture& texture, const std::string& filename, const sf::IntRect& partRect)
+    {
+        // Only reuse the texture when the exact same part of the image is used
+        const ImageKey key{filename, partRect};
+        const auto dataIt = m_imageMap.find(key);
+        if (dataIt != m_imageMap.end())
         {
-            auto it = m_imageMap.insert({filename, {}});
-            imageIt = it.first;
+            // The texture is now used at multiple places
+            ++(dataIt->second.users);
+
+            // Let the texture alert the texture manager when it is being copied or destroyed
+            texture.setCopyCallback(&TextureManager::copyTexture);
+            texture.setDestructCallback(&TextureManager::removeTexture);
+            return dataIt->second.data;
         }
 
-        // Add new data to the list
-        TextureDataHolder dataHolder;
+        // Add new data to the map. The elements of the map never move, so the data can point to its holder.
+        TextureDataHolder& dataHolder = m_imageMap[key];
         dataHolder.filename = filename;
         dataHolder.users = 1;
         dataHolder.data = std::make_shared<TextureData>();
         dataHolder.data->rect = partRect;
-        imageIt->second.push_back(std::move(dataHolder));
+        dataHolder.data->holder = &dataHolder;
+        ++m_sharedImages[filename].parts;
 
         // Let the texture alert the texture manager when it is being copied or destroyed
         texture.setCopyCallback(&TextureManager::copyTexture);
         texture.setDestructCallback(&TextureManager::removeTexture);
 
         // Load the image
-        auto data = imageIt->second.back().data;
+        auto data = dataHolder.data;
         data->image = texture.getImageLoader()(filename);
         if (data->image != nullptr)
         {
-            // Create a texture from the image
-            bool loadFromImageSuccess;
-            if (partRect == sf::IntRect{})
-                loadFromImageSuccess = data->texture.loadFromImage(*data->image);
-            else
-                loadFromImageSuccess = data->texture.loadFromImage(*data->image, partRect);
+            bool loadFromImageSuccess = m_atlasEnabled && loadSharedTexture(*data, filename);
+            if (!loadFromImageSuccess)
+            {
+                // Create a texture from the image
+                data->texture = std::make_shared<sf::Texture>();
+                if (partRect == sf::IntRect{})
+                    loadFromImageSuccess = data->texture->loadFromImage(*data->image);
+                else
+                    loadFromImageSuccess = data->texture->loadFromImage(*data->image, partRect);
+
+                data->textureRect = {0, 0, static_cast<int>(data->texture->getSize().x), static_cast<int>(data->texture->getSize().y)};
+            }
 
             if (loadFromImageSuccess)
+            {
+                // Once the image is on the gpu, only the opacity of its pixels is still needed
+                createOpacityMask(*data);
+                if (!m_keepImagesInMemory)
+                    data->image = nullptr;
+
                 return data;
-            else
-                return nullptr;
+            }
         }
 
         // The image could not be loaded
-        m_imageMap.erase(imageIt);
+        removeTexture(data);
         return nullptr;
     }
 
@@ -102,50 +156,215 @@ namespace tgui
 
     void TextureManager::copyTexture(std::shared_ptr<TextureData> textureDataToCopy)
     {
-        // Loop all our textures to check if we already have this one
-        for (auto& dataHolder : m_imageMap)
+        if (!textureDataToCopy->holder)
+            throw Exception{"Trying to copy texture data that was not loaded by the TextureManager."};
+
+        // The texture is now used at multiple places
+        ++(textureDataToCopy->holder->users);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeTexture(std::shared_ptr<TextureData> textureDataToRemove)
+    {
+        TextureDataHolder* holder = textureDataToRemove->holder;
+        if (!holder)
+            throw Exception{"Trying to remove a texture that was not loaded by the TextureManager."};
+
+        // If this was the only place where the texture is used then delete it
+        if (--(holder->users) == 0)
+        {
+            const std::string filename = holder->filename;
+            textureDataToRemove->holder = nullptr;
+            m_imageMap.erase(ImageKey{filename, textureDataToRemove->rect, holder->separate});
+
+            // Forget about the image once none of its parts are still loaded
+            const auto sharedImageIt = m_sharedImages.find(filename);
+            if ((sharedImageIt != m_sharedImages.end()) && (--(sharedImageIt->second.parts) == 0))
+                m_sharedImages.erase(sharedImageIt);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<TextureData> TextureManager::getSeparateTexture(Texture& texture, std::shared_ptr<TextureData> textureData)
+    {
+        if (!textureData->holder)
+            throw Exception{"Trying to separate texture data that was not loaded by the TextureManager."};
+
+        const std::string filename = textureData->holder->filename;
+        const ImageKey key{filename, textureData->rect, true};
+        const auto dataIt = m_imageMap.find(key);
+        if (dataIt != m_imageMap.end())
+        {
+            ++(dataIt->second.users);
+
+            texture.setCopyCallback(&TextureManager::copyTexture);
+            texture.setDestructCallback(&TextureManager::removeTexture);
+            return dataIt->second.data;
+        }
+
+        // Copy the image from the shared texture into a texture of its own
+        auto data = std::make_shared<TextureData>();
+        data->texture = std::make_shared<sf::Texture>();
+        if (textureData->image)
+        {
+            if (!data->texture->loadFromImage(*textureData->image, textureData->rect))
+                return nullptr;
+
+            data->image = std::make_unique<sf::Image>(*textureData->image);
+        }
+        else
+        {
+            if (!data->texture->loadFromImage(textureData->texture->copyToImage(), textureData->textureRect))
+                return nullptr;
+        }
+
+        data->textureRect = {0, 0, static_cast<int>(data->texture->getSize().x), static_cast<int>(data->texture->getSize().y)};
+        data->rect = textureData->rect;
+        data->opacityMask = textureData->opacityMask;
+        data->shader = textureData->shader;
+
+        TextureDataHolder& dataHolder = m_imageMap[key];
+        dataHolder.filename = filename;
+        dataHolder.users = 1;
+        dataHolder.separate = true;
+        dataHolder.data = data;
+        data->holder = &dataHolder;
+        ++m_sharedImages[filename].parts;
+
+        texture.setCopyCallback(&TextureManager::copyTexture);
+        texture.setDestructCallback(&TextureManager::removeTexture);
+        return data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::ImageKeyHash::operator()(const ImageKey& key) const
+    {
+        std::size_t hash = std::hash<std::string>{}(key.filename);
+        for (const int value : {key.rect.left, key.rect.top, key.rect.width, key.rect.height, static_cast<int>(key.separate)})
+            hash ^= std::hash<int>{}(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+        return hash;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasEnabled(bool enabled)
+    {
+        m_atlasEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isAtlasEnabled()
+    {
+        return m_atlasEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setKeepImagesInMemory(bool keep)
+    {
+        m_keepImagesInMemory = keep;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::getKeepImagesInMemory()
+    {
+        return m_keepImagesInMemory;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::loadSharedTexture(TextureData& data, const std::string& filename)
+    {
+        const sf::Vector2u imageSize = data.image->getSize();
+        if ((imageSize.x == 0) || (imageSize.y == 0))
+            return false;
+
+        // The image is only uploaded the first time one of its parts is loaded.
+        // A texture on which the smooth filter was enabled is no longer shared, so the image is uploaded again in that case.
+        SharedImage& sharedImage = m_sharedImages[filename];
+        std::shared_ptr<sf::Texture> texture = sharedImage.texture.lock();
+        if (!texture || texture->isSmooth())
         {
-            for (auto& data : dataHolder.second)
+            if ((imageSize.x <= AtlasMaxImageSize) && (imageSize.y <= AtlasMaxImageSize))
+                texture = addToAtlas(*data.image, sharedImage.rect);
+            else
             {
-                // Check if the pointer points to our texture
-                if (data.data == textureDataToCopy)
-                {
-                    // The texture is now used at multiple places
-                    ++data.users;
-                    return;
-                }
+                texture = std::make_shared<sf::Texture>();
+                if (!texture->loadFromImage(*data.image))
+                    texture = nullptr;
+
+                sharedImage.rect = {0, 0, static_cast<int>(imageSize.x), static_cast<int>(imageSize.y)};
             }
+
+            if (!texture)
+                return false;
+
+            sharedImage.texture = texture;
         }
 
-        throw Exception{"Trying to copy texture data that was not loaded by the TextureManager."};
+        const sf::IntRect area = getImagePart(imageSize, data.rect);
+        if ((area.width <= 0) || (area.height <= 0))
+            return false;
+
+        data.texture = texture;
+        data.textureRect = {sharedImage.rect.left + area.left, sharedImage.rect.top + area.top, area.width, area.height};
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextureManager::removeTexture(std::shared_ptr<TextureData> textureDataToRemove)
+    std::shared_ptr<sf::Texture> TextureManager::addToAtlas(const sf::Image& image, sf::IntRect& rect)
     {
-        // Loop all our textures to check which one it is
-        for (auto imageIt = m_imageMap.begin(); imageIt != m_imageMap.end(); ++imageIt)
+        const sf::Vector2u imageSize = image.getSize();
+        const unsigned int pageSize = std::min(AtlasPageSize, sf::Texture::getMaximumSize());
+        if ((imageSize.x > pageSize) || (imageSize.y > pageSize))
+            return nullptr;
+
+        // The space inside a page is not reused, a page is only released once none of its images is still being used
+        m_atlasPages.erase(std::remove_if(m_atlasPages.begin(), m_atlasPages.end(), [](const AtlasPage& page){ return page.texture.expired(); }),
+                           m_atlasPages.end());
+
+        const auto placeImage = [&](AtlasPage& page, std::shared_ptr<sf::Texture> texture){
+            texture->update(image, page.shelfRight, page.shelfTop);
+            rect = {static_cast<int>(page.shelfRight), static_cast<int>(page.shelfTop), static_cast<int>(imageSize.x), static_cast<int>(imageSize.y)};
+
+            page.shelfRight += imageSize.x + AtlasPadding;
+            page.shelfHeight = std::max(page.shelfHeight, imageSize.y);
+            return texture;
+        };
+
+        for (auto& page : m_atlasPages)
         {
-            for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
+            // Start a new shelf when the image doesn't fit next to the images on the current one
+            if (page.shelfRight + imageSize.x > pageSize)
             {
-                // Check if the pointer points to our texture
-                if (dataIt->data == textureDataToRemove)
-                {
-                    // If this was the only place where the texture is used then delete it
-                    if (--(dataIt->users) == 0)
-                    {
-                        imageIt->second.erase(dataIt);
-                        if (imageIt->second.empty())
-                            m_imageMap.erase(imageIt);
-                    }
-
-                    return;
-                }
+                if (page.shelfTop + page.shelfHeight + AtlasPadding + imageSize.y > pageSize)
+                    continue;
+
+                page.shelfTop += page.shelfHeight + AtlasPadding;
+                page.shelfRight = 0;
+                page.shelfHeight = 0;
             }
+
+            if (page.shelfTop + imageSize.y <= pageSize)
+                return placeImage(page, page.texture.lock());
         }
 
-        throw Exception{"Trying to remove a texture that was not loaded by the TextureManager."};
+        // None of the existing pages has room for the image
+        auto texture = std::make_shared<sf::Texture>();
+        if (!texture->create(pageSize, pageSize))
+            return nullptr;
+
+        AtlasPage page;
+        page.texture = texture;
+        m_atlasPages.push_back(page);
+        return placeImage(m_atlasPages.back(), texture);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,8 +28,8 @@
 #include <TGUI/Animation.hpp>
 #include <TGUI/Vector2f.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
+#include <TGUI/PrimitiveBatch.hpp>
 #include <SFML/System/Err.hpp>
-#include <SFML/Graphics/RectangleShape.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -97,6 +97,7 @@ namespace tgui
         m_parent                       {nullptr},
         m_draggableWidget              {other.m_draggableWidget},
         m_containerWidget              {other.m_containerWidget},
+        m_drawnThroughPrimitiveBatch   {other.m_drawnThroughPrimitiveBatch},
         m_toolTip                      {other.m_toolTip ? other.m_toolTip->clone() : nullptr},
         m_renderer                     {other.m_renderer},
         m_showAnimations               {other.m_showAnimations},
@@ -136,6 +137,7 @@ namespace tgui
         m_animationTimeElapsed         {std::move(other.m_animationTimeElapsed)},
         m_draggableWidget              {std::move(other.m_draggableWidget)},
         m_containerWidget              {std::move(other.m_containerWidget)},
+        m_drawnThroughPrimitiveBatch   {std::move(other.m_drawnThroughPrimitiveBatch)},
         m_toolTip                      {std::move(other.m_toolTip)},
         m_renderer                     {other.m_renderer},
         m_showAnimations               {std::move(other.m_showAnimations)},
@@ -182,9 +184,11 @@ namespace tgui
             m_mouseHover           = false;
             m_mouseDown            = false;
             m_focused              = false;
+            m_invalidated          = true;
             m_animationTimeElapsed = {};
             m_draggableWidget      = other.m_draggableWidget;
             m_containerWidget      = other.m_containerWidget;
+            m_drawnThroughPrimitiveBatch = other.m_drawnThroughPrimitiveBatch;
             m_toolTip              = other.m_toolTip ? other.m_toolTip->clone() : nullptr;
             m_renderer             = other.m_renderer;
             m_showAnimations       = {};
@@ -231,9 +235,11 @@ namespace tgui
             m_mouseHover           = std::move(other.m_mouseHover);
             m_mouseDown            = std::move(other.m_mouseDown);
             m_focused              = std::move(other.m_focused);
+            m_invalidated          = true;
             m_animationTimeElapsed = std::move(other.m_animationTimeElapsed);
             m_draggableWidget      = std::move(other.m_draggableWidget);
             m_containerWidget      = std::move(other.m_containerWidget);
+            m_drawnThroughPrimitiveBatch = std::move(other.m_drawnThroughPrimitiveBatch);
             m_toolTip              = std::move(other.m_toolTip);
             m_renderer             = std::move(other.m_renderer);
             m_showAnimations       = std::move(other.m_showAnimations);
@@ -303,6 +309,8 @@ namespace tgui
             rendererChanged(newIt->first);
             ++newIt;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -362,6 +370,11 @@ namespace tgui
         if (getPosition() != m_prevPosition)
         {
             m_prevPosition = getPosition();
+
+            // Moving the widget changes how its parent looks, the widget itself is drawn the same on its new position
+            if (m_parent)
+                m_parent->invalidate();
+
             onPositionChange.emit(this, getPosition());
 
             for (auto& layout : m_boundPositionLayouts)
@@ -380,6 +393,7 @@ namespace tgui
         if (getSize() != m_prevSize)
         {
             m_prevSize = getSize();
+            invalidate();
             onSizeChange.emit(this, getSize());
 
             for (auto& layout : m_boundSizeLayouts)
@@ -537,6 +551,7 @@ namespace tgui
     void Widget::setVisible(bool visible)
     {
         m_visible = visible;
+        invalidate();
 
         // If the widget is hiden while still focused then it must be unfocused
         if (!visible)
@@ -548,6 +563,7 @@ namespace tgui
     void Widget::setEnabled(bool enabled)
     {
         m_enabled = enabled;
+        invalidate();
 
         if (!enabled)
         {
@@ -569,6 +585,7 @@ namespace tgui
             if (canGainFocus())
             {
                 m_focused = true;
+                invalidate();
                 onFocus.emit(this);
 
                 if (m_parent)
@@ -578,6 +595,7 @@ namespace tgui
         else // Unfocusing widget
         {
             m_focused = false;
+            invalidate();
             onUnfocus.emit(this);
         }
     }
@@ -611,6 +629,7 @@ namespace tgui
     {
         m_inheritedFont = font;
         rendererChanged("font");
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -626,6 +645,7 @@ namespace tgui
     {
         m_inheritedOpacity = opacity;
         rendererChanged("opacity");
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -665,6 +685,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::invalidate()
+    {
+        // The parents are marked as well, so that the gui only has to look at its root container to know whether it has to
+        // be drawn again and so that a container knows whether anything inside it changed
+        Widget* widget = this;
+        while (widget)
+        {
+            widget->m_invalidated = true;
+            widget = widget->m_parent;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::setParent(Container* parent)
     {
         m_parent = parent;
@@ -682,6 +716,9 @@ namespace tgui
     {
         m_animationTimeElapsed += elapsedTime;
 
+        if (m_showAnimations.empty())
+            return;
+
         for (unsigned int i = 0; i < m_showAnimations.size();)
         {
             if (m_showAnimations[i]->update(elapsedTime))
@@ -689,6 +726,8 @@ namespace tgui
             else
                 i++;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -983,6 +1022,7 @@ namespace tgui
     void Widget::mouseEnteredWidget()
     {
         m_mouseHover = true;
+        invalidate();
         onMouseEnter.emit(this);
     }
 
@@ -991,6 +1031,7 @@ namespace tgui
     void Widget::mouseLeftWidget()
     {
         m_mouseHover = false;
+        invalidate();
         onMouseLeave.emit(this);
     }
 
@@ -999,6 +1040,7 @@ namespace tgui
     void Widget::rendererChangedCallback(const std::string& property)
     {
         rendererChanged(property);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1008,14 +1050,17 @@ namespace tgui
                                     Vector2f size,
                                     Color color) const
     {
-        sf::RectangleShape shape{size};
-
         if (m_opacityCached < 1)
-            shape.setFillColor(Color::calcColorOpacity(color, m_opacityCached));
-        else
-            shape.setFillColor(color);
+            color = Color::calcColorOpacity(color, m_opacityCached);
+
+        const sf::Vertex vertices[] = {
+            {{0, 0}, color},
+            {{0, size.y}, color},
+            {{size.x, 0}, color},
+            {{size.x, size.y}, color}
+        };
 
-        target.draw(shape, states);
+        PrimitiveBatch::draw(target, vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1031,10 +1076,14 @@ namespace tgui
         // If size is too small then draw entire size as border
         if ((size.x <= borders.getLeft() + borders.getRight()) || (size.y <= borders.getTop() + borders.getBottom()))
         {
-            sf::RectangleShape border;
-            border.setFillColor(color);
-            border.setSize({size.x, size.y});
-            target.draw(border, states);
+            const sf::Vertex vertices[] = {
+                {{0, 0}, color},
+                {{0, size.y}, color},
+                {{size.x, 0}, color},
+                {{size.x, size.y}, color}
+            };
+
+            PrimitiveBatch::draw(target, vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
         }
         else // Draw borders in the normal way
         {
@@ -1048,7 +1097,7 @@ namespace tgui
             // |              | //
             // 2--------------4 //
             //////////////////////
-            const std::vector<sf::Vertex> vertices = {
+            const sf::Vertex vertices[] = {
                 {{0, 0}, color},
                 {{borders.getLeft(), 0}, color},
                 {{0, size.y}, color},
@@ -1061,7 +1110,7 @@ namespace tgui
                 {{borders.getLeft(), borders.getTop()}, color}
             };
 
-            target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+            PrimitiveBatch::draw(target, vertices, 10, sf::PrimitiveType::TrianglesStrip, states);
         }
     }
 
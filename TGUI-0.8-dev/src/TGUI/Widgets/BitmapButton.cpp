@@ -35,6 +35,7 @@ namespace tgui
     BitmapButton::BitmapButton()
     {
         m_type = "BitmapButton";
+        m_drawnThroughPrimitiveBatch = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -73,6 +74,8 @@ namespace tgui
 
         if (m_autoSize)
             updateSize();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -82,6 +85,7 @@ namespace tgui
         m_glyphTexture = image;
         m_glyphSprite.setTexture(m_glyphTexture);
         updateSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -97,6 +101,7 @@ namespace tgui
     {
         m_relativeGlyphHeight = relativeHeight;
         updateSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
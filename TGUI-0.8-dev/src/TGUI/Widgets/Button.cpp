@@ -34,6 +34,7 @@ namespace tgui
     Button::Button()
     {
         m_type = "Button";
+        m_drawnThroughPrimitiveBatch = true;
         m_text.setFont(m_fontCached);
 
         m_renderer = aurora::makeCopied<ButtonRenderer>();
@@ -114,6 +115,8 @@ namespace tgui
 
     void Button::setText(const sf::String& text)
     {
+        invalidate();
+
         m_string = text;
         m_text.setString(text);
 
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Canvas.hpp>
+#include <TGUI/PrimitiveBatch.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -34,6 +35,7 @@ namespace tgui
     Canvas::Canvas(const Layout2d& size)
     {
         m_type = "Canvas";
+        m_drawnThroughPrimitiveBatch = true;
 
         setSize(size);
     }
@@ -142,6 +144,7 @@ namespace tgui
     void Canvas::display()
     {
         m_renderTexture.display();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -159,7 +162,7 @@ namespace tgui
     void Canvas::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
-        target.draw(m_sprite, states);
+        PrimitiveBatch::draw(target, m_sprite, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
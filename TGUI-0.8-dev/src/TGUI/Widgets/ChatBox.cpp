@@ -25,16 +25,72 @@
 
 #include <TGUI/Widgets/ChatBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/PrimitiveBatch.hpp>
+
+#include <SFML/System/Utf.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Minimum amount of bytes reserved for a text chunk, a single line can still use a larger chunk
+        const std::size_t textChunkSize = 64 * 1024;
+
+        // Adds the two triangles of a character to the vertex array, in the same way as sf::Text does
+        void addGlyphQuad(sf::VertexArray& vertices, sf::Vector2f position, const sf::Color& color, const sf::Glyph& glyph, float italicShear)
+        {
+        #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+            const float padding = 1;
+        #else
+            const float padding = 0; // The glyphs already contain the padding in older SFML versions
+        #endif
+
+            const float left   = glyph.bounds.left - padding;
+            const float top    = glyph.bounds.top - padding;
+            const float right  = glyph.bounds.left + glyph.bounds.width + padding;
+            const float bottom = glyph.bounds.top + glyph.bounds.height + padding;
+
+            const float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+            const float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+            const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+            const float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
+
+            vertices.append({{position.x + left - italicShear * top, position.y + top}, color, {u1, v1}});
+            vertices.append({{position.x + right - italicShear * top, position.y + top}, color, {u2, v1}});
+            vertices.append({{position.x + left - italicShear * bottom, position.y + bottom}, color, {u1, v2}});
+            vertices.append({{position.x + left - italicShear * bottom, position.y + bottom}, color, {u1, v2}});
+            vertices.append({{position.x + right - italicShear * top, position.y + top}, color, {u2, v1}});
+            vertices.append({{position.x + right - italicShear * bottom, position.y + bottom}, color, {u2, v2}});
+        }
+
+        // Adds a line below or through the text to the vertex array. The texture coordinates point to the white pixel that
+        // SFML reserves in the glyph texture of the font since SFML 2.4, they are ignored when drawing without a texture.
+        void addHorizontalLine(sf::VertexArray& vertices, float left, float right, float offset, float thickness, const sf::Color& color)
+        {
+            const float top = std::floor(offset - (thickness / 2) + 0.5f);
+            const float bottom = top + std::floor(thickness + 0.5f);
+
+            vertices.append({{left, top}, color, {1, 1}});
+            vertices.append({{right, top}, color, {1, 1}});
+            vertices.append({{left, bottom}, color, {1, 1}});
+            vertices.append({{left, bottom}, color, {1, 1}});
+            vertices.append({{right, top}, color, {1, 1}});
+            vertices.append({{right, bottom}, color, {1, 1}});
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     ChatBox::ChatBox()
     {
         m_type = "ChatBox";
+        m_drawnThroughPrimitiveBatch = true;
         m_draggableWidget = true;
 
         m_renderer = aurora::makeCopied<ChatBoxRenderer>();
@@ -122,31 +178,65 @@ namespace tgui
 
     void ChatBox::addLine(const sf::String& text, Color color)
     {
-        // Remove the oldest line if you exceed the maximum
-        if ((m_maxLines > 0) && (m_maxLines == m_lines.size()))
-        {
-            if (m_newLinesBelowOthers)
-                removeLine(0);
-            else
-                removeLine(m_maxLines-1);
-        }
+        insertLine(text, color, {});
+        updateFullTextHeight();
+        updateDisplayedText();
+    }
 
-        Line line;
-        line.string = text;
-        line.text.setColor(color);
-        line.text.setOpacity(m_opacityCached);
-        line.text.setCharacterSize(m_textSize);
-        line.text.setString(text);
-        line.text.setFont(m_fontCached);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        recalculateLineText(line);
+    void ChatBox::addLines(const std::vector<sf::String>& lines)
+    {
+        addLines(lines, m_textColor);
+    }
 
-        if (m_newLinesBelowOthers)
-            m_lines.push_back(std::move(line));
-        else
-            m_lines.push_front(std::move(line));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::addLines(const std::vector<sf::String>& lines, Color color)
+    {
+        // When there are more new lines than fit in the chat box then the oldest ones would be removed again immediately
+        std::size_t firstLine = 0;
+        if ((m_maxLines > 0) && (lines.size() > m_maxLines))
+            firstLine = lines.size() - m_maxLines;
+
+        for (std::size_t i = firstLine; i < lines.size(); ++i)
+            insertLine(lines[i], color, {});
+
+        updateFullTextHeight();
+        updateDisplayedText();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::addLine(const std::vector<Span>& spans)
+    {
+        sf::String text;
+        std::vector<SpanFormat> spanFormats;
+        spanFormats.reserve(spans.size());
+        for (const auto& span : spans)
+        {
+            text += span.text;
+
+            SpanFormat format;
+            format.end = static_cast<std::uint32_t>(text.getSize());
+            format.color = span.color.isSet() ? span.color : m_textColor;
+            format.style = span.style;
+            sf::Utf32::toUtf8(span.link.begin(), span.link.end(), std::back_inserter(format.link));
+            spanFormats.push_back(std::move(format));
+        }
+
+        // The formatting doesn't have to be stored when the spans only differ in the text
+        const Color color = spanFormats.empty() ? m_textColor : spanFormats.front().color;
+        if (std::all_of(spanFormats.begin(), spanFormats.end(), [color](const SpanFormat& format){
+                return (format.color == color) && (format.style == sf::Text::Regular) && format.link.empty();
+            }))
+        {
+            spanFormats.clear();
+        }
 
-        recalculateFullTextHeight();
+        insertLine(text, color, std::move(spanFormats));
+        updateFullTextHeight();
+        updateDisplayedText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -155,7 +245,7 @@ namespace tgui
     {
         if (lineIndex < m_lines.size())
         {
-            return m_lines[lineIndex].string;
+            return getLineText(m_lines[lineIndex]);
         }
         else // Index too high
             return "";
@@ -167,7 +257,7 @@ namespace tgui
     {
         if (lineIndex < m_lines.size())
         {
-            return m_lines[lineIndex].text.getColor();
+            return m_lines[lineIndex].color;
         }
         else // Index too high
             return m_textColor;
@@ -179,9 +269,24 @@ namespace tgui
     {
         if (lineIndex < m_lines.size())
         {
+            // Move the lines on the shortest side of the removed line to fill the gap
+            const float lineHeight = m_lines[lineIndex].height;
+            if (lineIndex < m_lines.size() / 2)
+            {
+                for (std::size_t i = 0; i < lineIndex; ++i)
+                    m_lines[i].top += lineHeight;
+            }
+            else
+            {
+                for (std::size_t i = lineIndex + 1; i < m_lines.size(); ++i)
+                    m_lines[i].top -= lineHeight;
+            }
+
+            releaseLineText(m_lines[lineIndex]);
             m_lines.erase(m_lines.begin() + lineIndex);
 
-            recalculateFullTextHeight();
+            updateFullTextHeight();
+            updateDisplayedText();
             return true;
         }
         else // Index too high
@@ -194,7 +299,12 @@ namespace tgui
     {
         m_lines.clear();
 
-        recalculateFullTextHeight();
+        // None of the text chunks are still in use
+        m_firstTextChunkId += m_textChunks.size();
+        m_textChunks.clear();
+
+        updateFullTextHeight();
+        updateDisplayedText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -214,11 +324,19 @@ namespace tgui
         if ((m_maxLines > 0) && (m_maxLines < m_lines.size()))
         {
             if (m_newLinesBelowOthers)
-                m_lines.erase(m_lines.begin(), m_lines.begin() + m_lines.size() - m_maxLines);
+            {
+                const auto lastRemovedLine = m_lines.begin() + m_lines.size() - m_maxLines;
+                std::for_each(m_lines.begin(), lastRemovedLine, [this](const Line& line){ releaseLineText(line); });
+                m_lines.erase(m_lines.begin(), lastRemovedLine);
+            }
             else
+            {
+                std::for_each(m_lines.begin() + m_maxLines, m_lines.end(), [this](const Line& line){ releaseLineText(line); });
                 m_lines.erase(m_lines.begin() + m_maxLines, m_lines.end());
+            }
 
-            recalculateFullTextHeight();
+            updateFullTextHeight();
+            updateDisplayedText();
         }
     }
 
@@ -236,9 +354,6 @@ namespace tgui
         m_textSize = size;
         m_scroll->setScrollAmount(size);
 
-        for (auto& line : m_lines)
-            line.text.setCharacterSize(size);
-
         recalculateAllLines();
     }
 
@@ -268,7 +383,10 @@ namespace tgui
     void ChatBox::setLinesStartFromTop(bool startFromTop)
     {
         if (m_linesStartFromTop != startFromTop)
+        {
             m_linesStartFromTop = startFromTop;
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -314,7 +432,10 @@ namespace tgui
 
         // Pass the event to the scrollbar
         if (m_scroll->mouseOnWidget(pos - getPosition()))
+        {
             m_scroll->leftMousePressed(pos - getPosition());
+            updateDisplayedText();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -322,7 +443,20 @@ namespace tgui
     void ChatBox::leftMouseReleased(Vector2f pos)
     {
         if (m_scroll->isMouseDown())
+        {
             m_scroll->leftMouseReleased(pos - getPosition());
+            updateDisplayedText();
+        }
+        else if (m_mouseDown)
+        {
+            const LinkArea* linkArea = getLinkAtPosition(pos);
+            if (linkArea)
+            {
+                std::basic_string<sf::Uint32> link;
+                sf::Utf8::toUtf32(linkArea->link.begin(), linkArea->link.end(), std::back_inserter(link));
+                onLinkClick.emit(this, sf::String{link});
+            }
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -334,9 +468,15 @@ namespace tgui
 
         // Pass the event to the scrollbar when the mouse is on top of it or when we are dragging its thumb
         if (((m_scroll->isMouseDown()) && (m_scroll->isMouseDownOnThumb())) || m_scroll->mouseOnWidget(pos - getPosition()))
+        {
             m_scroll->mouseMoved(pos - getPosition());
+            updateDisplayedText();
+        }
         else
             m_scroll->mouseNoLongerOnWidget();
+
+        if (m_scroll->hasHoverChanged())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -345,6 +485,8 @@ namespace tgui
     {
         Widget::mouseNoLongerOnWidget();
         m_scroll->mouseNoLongerOnWidget();
+        if (m_scroll->hasHoverChanged())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -360,40 +502,239 @@ namespace tgui
     void ChatBox::mouseWheelScrolled(float delta, Vector2f pos)
     {
         if (m_scroll->getViewportSize() < m_scroll->getMaximum())
+        {
             m_scroll->mouseWheelScrolled(delta, pos - getPosition());
+            updateDisplayedText();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ChatBox::recalculateLineText(Line& line)
     {
-        line.text.setString("");
+        line.wrapGeneration = m_wrapGeneration;
+        line.wrapPositions.clear();
 
-        // Find the maximum width of one line
-        const float maxWidth = getInnerSize().x - m_scroll->getSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight();
-        if (maxWidth < 0)
+        if (!m_fontCached)
+        {
+            line.height = 0;
             return;
+        }
+
+        // Find the maximum width of one line
+        std::size_t rows = 1;
+        const float maxWidth = getMaxLineWidth();
+        if (maxWidth >= 0)
+        {
+            const sf::String text = getLineText(line);
+            // When part of the line is bold then the whole line is wrapped as if it were bold, so that the text always fits
+            const bool bold = std::any_of(line.spans.begin(), line.spans.end(), [](const SpanFormat& span){ return (span.style & sf::Text::Bold) != 0; });
+            Text::wordWrap(m_wrappedLines, maxWidth, text, m_fontCached, m_textSize, bold);
+
+            // Lines that don't start directly after a newline in the text were split by the word-wrap
+            rows = m_wrappedLines.size();
+            for (std::size_t i = 1; i < m_wrappedLines.size(); ++i)
+            {
+                if (text[m_wrappedLines[i].begin - 1] != '\n')
+                    line.wrapPositions.push_back(static_cast<std::uint32_t>(m_wrappedLines[i].begin));
+            }
+        }
 
-        line.text.setString(Text::wordWrap(maxWidth, line.string, m_fontCached, line.text.getCharacterSize(), false));
+        line.height = rows * m_lineSpacingCached + m_extraVerticalSpaceCached;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ChatBox::recalculateAllLines()
     {
+        // Remember which line is shown at the top, so that it can remain there when the height of the lines change
+        const bool scrolledToBottom = (m_scroll->getValue() + m_scroll->getViewportSize() >= m_scroll->getMaximum());
+        const std::size_t topLineIndex = getLineIndexAtHeight(static_cast<float>(m_scroll->getValue()));
+
+        // All lines become outdated, they will only be word-wrapped again when they become visible
+        m_wrapGeneration++;
+
+        m_lineSpacingCached = m_fontCached.getLineSpacing(m_textSize);
+        m_extraVerticalSpaceCached = Text::calculateExtraVerticalSpace(m_fontCached, m_textSize);
+
+        // The width of an average character is used to estimate how many times the lines have to be split
+        m_estimatedCharacterWidth = 0;
+        if (m_fontCached)
+        {
+            const std::string sampleText = "abcdefghijklmnopqrstuvwxyz ";
+            for (const char c : sampleText)
+                m_estimatedCharacterWidth += m_fontCached.getGlyph(static_cast<std::uint32_t>(c), m_textSize, false).advance;
+
+            m_estimatedCharacterWidth /= static_cast<float>(sampleText.length());
+        }
+
         for (auto& line : m_lines)
-            recalculateLineText(line);
+            line.height = estimateLineHeight(line.length);
+
+        recalculateLinePositions();
 
-        recalculateFullTextHeight();
+        if (scrolledToBottom)
+        {
+            if (m_scroll->getMaximum() > m_scroll->getViewportSize())
+                m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getViewportSize());
+        }
+        else if (topLineIndex < m_lines.size())
+            m_scroll->setValue(static_cast<unsigned int>(m_lines[topLineIndex].top - m_lines.front().top));
+
+        updateDisplayedText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChatBox::recalculateFullTextHeight()
+    float ChatBox::estimateLineHeight(std::size_t length) const
     {
-        m_fullTextHeight = 0;
-        for (const auto& line : m_lines)
-            m_fullTextHeight += line.text.getSize().y;
+        if (!m_fontCached)
+            return 0;
+
+        // The length in bytes equals the amount of characters for ASCII text, which is close enough for an estimation
+        float lines = 1;
+        const float maxWidth = getMaxLineWidth();
+        if (maxWidth > 0)
+            lines = std::max(1.f, std::ceil(length * m_estimatedCharacterWidth / maxWidth));
+
+        return lines * m_lineSpacingCached + m_extraVerticalSpaceCached;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float ChatBox::getMaxLineWidth() const
+    {
+        return getInnerSize().x - m_scroll->getSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::insertLine(const sf::String& text, Color color, std::vector<SpanFormat> spans)
+    {
+        // Remove the oldest line if you exceed the maximum
+        if ((m_maxLines > 0) && (m_maxLines == m_lines.size()))
+        {
+            // Removing the first or last line doesn't change the position of the other lines
+            if (m_newLinesBelowOthers)
+            {
+                releaseLineText(m_lines.front());
+                m_lines.pop_front();
+            }
+            else
+            {
+                releaseLineText(m_lines.back());
+                m_lines.pop_back();
+            }
+        }
+
+        // The line isn't word-wrapped yet, this only happens when it becomes visible
+        Line line;
+        storeLineText(line, text);
+        line.color = color;
+        line.spans = std::move(spans);
+        line.height = estimateLineHeight(line.length);
+
+        if (m_newLinesBelowOthers)
+        {
+            if (!m_lines.empty())
+                line.top = m_lines.back().top + m_lines.back().height;
+
+            m_lines.push_back(std::move(line));
+        }
+        else
+        {
+            if (!m_lines.empty())
+                line.top = m_lines.front().top - line.height;
+
+            m_lines.push_front(std::move(line));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::storeLineText(Line& line, const sf::String& text)
+    {
+        // A character takes at most 4 bytes in UTF-8. The chunk is never reallocated while appending, the reserved memory
+        // is only used to determine whether the text still fits.
+        const std::size_t maxLength = text.getSize() * 4;
+        if (m_textChunks.empty() || (m_textChunks.back().data.capacity() - m_textChunks.back().data.size() < maxLength))
+        {
+            m_textChunks.emplace_back();
+            m_textChunks.back().data.reserve(std::max(textChunkSize, maxLength));
+        }
+
+        TextChunk& chunk = m_textChunks.back();
+        line.chunk = m_firstTextChunkId + m_textChunks.size() - 1;
+        line.offset = static_cast<std::uint32_t>(chunk.data.size());
+        sf::Utf32::toUtf8(text.begin(), text.end(), std::back_inserter(chunk.data));
+        line.length = static_cast<std::uint32_t>(chunk.data.size() - line.offset);
+        chunk.lineCount++;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::releaseLineText(const Line& line)
+    {
+        TextChunk& chunk = m_textChunks[line.chunk - m_firstTextChunkId];
+        if (--chunk.lineCount > 0)
+            return;
+
+        // The memory is freed immediately, but the chunk itself is only removed once it is at the front, so that the chunks
+        // in the list keep consecutive ids. The list may become empty, ids are still never reused for a different text
+        // because m_firstTextChunkId only increases.
+        std::string().swap(chunk.data);
+        while (!m_textChunks.empty() && (m_textChunks.front().lineCount == 0))
+        {
+            m_textChunks.pop_front();
+            m_firstTextChunkId++;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String ChatBox::getLineText(const Line& line) const
+    {
+        const std::string& data = m_textChunks[line.chunk - m_firstTextChunkId].data;
+
+        std::basic_string<sf::Uint32> text;
+        text.reserve(line.length);
+        sf::Utf8::toUtf32(data.begin() + line.offset, data.begin() + line.offset + line.length, std::back_inserter(text));
+        return text;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::recalculateLinePositions()
+    {
+        float top = 0;
+        for (auto& line : m_lines)
+        {
+            line.top = top;
+            top += line.height;
+        }
+
+        updateFullTextHeight();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::updateFullTextHeight()
+    {
+        if (!m_lines.empty())
+        {
+            m_fullTextHeight = m_lines.back().top + m_lines.back().height - m_lines.front().top;
+
+            // When lines keep being added on one side and removed on the other side, the positions drift away from 0.
+            // Move them back once the offset becomes larger than the lines themselves, to not lose floating point precision.
+            const float offset = m_lines.front().top;
+            if (std::abs(offset) > m_fullTextHeight)
+            {
+                for (auto& line : m_lines)
+                    line.top -= offset;
+            }
+        }
+        else
+            m_fullTextHeight = 0;
 
         // Update the maximum of the scrollbar
         const unsigned int oldMaximum = m_scroll->getMaximum();
@@ -412,6 +753,257 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t ChatBox::getLineIndexAtHeight(float height) const
+    {
+        if (m_lines.empty())
+            return 0;
+
+        // The lines are sorted on their position, so a binary search can be used to find the line
+        const float position = m_lines.front().top + height;
+        const auto it = std::upper_bound(m_lines.begin(), m_lines.end(), position,
+                                         [](float pos, const Line& line){ return pos < line.top + line.height; });
+        return static_cast<std::size_t>(it - m_lines.begin());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::updateDisplayedText()
+    {
+        const float visibleHeight = getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom();
+
+        // The real height of a line is only known after it is word-wrapped. When it differs from the estimated height then
+        // other lines may become visible, so this is repeated until all visible lines are up-to-date.
+        bool heightChanged = true;
+        while (heightChanged && !m_lines.empty())
+        {
+            heightChanged = false;
+
+            const float visibleTop = static_cast<float>(m_scroll->getValue());
+            const float visibleBottom = m_lines.front().top + visibleTop + visibleHeight;
+
+            std::size_t firstChangedLine = 0;
+            for (std::size_t i = getLineIndexAtHeight(visibleTop); (i < m_lines.size()) && (m_lines[i].top < visibleBottom); ++i)
+            {
+                if (m_lines[i].wrapGeneration == m_wrapGeneration)
+                    continue;
+
+                const float oldHeight = m_lines[i].height;
+                recalculateLineText(m_lines[i]);
+                if (!heightChanged && (m_lines[i].height != oldHeight))
+                {
+                    heightChanged = true;
+                    firstChangedLine = i;
+                }
+            }
+
+            if (heightChanged)
+            {
+                // Only the lines below the changed line have to move
+                for (std::size_t i = firstChangedLine + 1; i < m_lines.size(); ++i)
+                    m_lines[i].top = m_lines[i-1].top + m_lines[i-1].height;
+
+                updateFullTextHeight();
+            }
+        }
+
+        updateVisibleLines();
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::updateVisibleLines()
+    {
+        std::size_t firstVisibleLine = 0;
+        std::vector<VisibleLine> visibleLines;
+        if (!m_lines.empty())
+        {
+            const float visibleHeight = getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom();
+            const float visibleTop = static_cast<float>(m_scroll->getValue());
+            const float visibleBottom = m_lines.front().top + visibleTop + visibleHeight;
+
+            firstVisibleLine = getLineIndexAtHeight(visibleTop);
+            for (std::size_t i = firstVisibleLine; (i < m_lines.size()) && (m_lines[i].top < visibleBottom); ++i)
+            {
+                VisibleLine visibleLine;
+                visibleLine.chunk = m_lines[i].chunk;
+                visibleLine.offset = m_lines[i].offset;
+                visibleLine.wrapGeneration = m_lines[i].wrapGeneration;
+                visibleLines.push_back(visibleLine);
+            }
+        }
+
+        // Scrolling without other lines becoming visible only changes the transform with which the vertices are drawn
+        const auto equalLines = [](const VisibleLine& left, const VisibleLine& right){
+                return (left.chunk == right.chunk) && (left.offset == right.offset) && (left.wrapGeneration == right.wrapGeneration);
+            };
+        if ((firstVisibleLine == m_firstVisibleLine) && (visibleLines.size() == m_visibleLines.size())
+         && std::equal(visibleLines.begin(), visibleLines.end(), m_visibleLines.begin(), equalLines))
+            return;
+
+        m_firstVisibleLine = firstVisibleLine;
+        m_visibleLines = std::move(visibleLines);
+        rebuildTextVertices();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::rebuildTextVertices()
+    {
+        m_textVertices.clear();
+        m_linkAreas.clear();
+    #if SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR < 4
+        m_lineVertices.clear();
+    #endif
+        if (m_visibleLines.empty() || !m_fontCached || (getMaxLineWidth() < 0))
+            return;
+
+        const float whitespaceWidth = m_fontCached.getGlyph(' ', m_textSize, false).advance;
+        const float boldWhitespaceWidth = m_fontCached.getGlyph(' ', m_textSize, true).advance;
+
+    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+        const std::shared_ptr<sf::Font> font = m_fontCached;
+        const float underlineOffset = font->getUnderlinePosition(m_textSize);
+        const float underlineThickness = font->getUnderlineThickness(m_textSize);
+        const sf::FloatRect xBounds = font->getGlyph('x', m_textSize, false).bounds;
+        const float strikeThroughOffset = xBounds.top + xBounds.height / 2.f;
+
+        // The lines can be drawn together with the glyphs, as they use the white pixel in the font texture
+        sf::VertexArray& lineVertices = m_textVertices;
+    #else
+        const float underlineOffset = m_textSize * 0.1f;
+        const float underlineThickness = m_textSize * 0.07f;
+
+        sf::VertexArray& lineVertices = m_lineVertices;
+    #endif
+
+        // Lines without spans are drawn as if they consist of a single span
+        std::vector<SpanFormat> singleSpan(1);
+
+        const float firstLineTop = m_lines[m_firstVisibleLine].top;
+        for (std::size_t i = m_firstVisibleLine; i < m_firstVisibleLine + m_visibleLines.size(); ++i)
+        {
+            const Line& line = m_lines[i];
+            const sf::String text = getLineText(line);
+
+            singleSpan[0].end = static_cast<std::uint32_t>(text.getSize());
+            singleSpan[0].color = line.color;
+            const std::vector<SpanFormat>& spans = line.spans.empty() ? singleSpan : line.spans;
+
+            // Like in sf::Text, the vertical position is the baseline of the characters
+            sf::Vector2f position{0, line.top - firstLineTop + m_textSize};
+            float runStart = 0;
+            std::uint32_t prevChar = 0;
+            std::size_t spanIndex = 0;
+            sf::Color color = Color::calcColorOpacity(spans[0].color, m_opacityCached);
+            auto wrapPositionIt = line.wrapPositions.begin();
+
+            // Adds the decorations of the part of the span that lies on the current row
+            const auto finishRun = [&]{
+                    const SpanFormat& span = spans[spanIndex];
+                    if (position.x > runStart)
+                    {
+                        if (span.style & sf::Text::Underlined)
+                            addHorizontalLine(lineVertices, runStart, position.x, position.y + underlineOffset, underlineThickness, color);
+                    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+                        if (span.style & sf::Text::StrikeThrough)
+                            addHorizontalLine(lineVertices, runStart, position.x, position.y + strikeThroughOffset, underlineThickness, color);
+                    #endif
+                        if (!span.link.empty())
+                            m_linkAreas.push_back({{runStart, position.y - m_textSize, position.x - runStart, m_lineSpacingCached}, span.link});
+                    }
+
+                    runStart = position.x;
+                };
+
+            for (std::size_t j = 0; j < text.getSize(); ++j)
+            {
+                if ((spanIndex + 1 < spans.size()) && (j >= spans[spanIndex].end))
+                {
+                    finishRun();
+                    while ((spanIndex + 1 < spans.size()) && (j >= spans[spanIndex].end))
+                        ++spanIndex;
+
+                    color = Color::calcColorOpacity(spans[spanIndex].color, m_opacityCached);
+                }
+
+                if ((wrapPositionIt != line.wrapPositions.end()) && (*wrapPositionIt == j))
+                {
+                    finishRun();
+                    position = {0, position.y + m_lineSpacingCached};
+                    runStart = 0;
+                    prevChar = 0;
+                    ++wrapPositionIt;
+                }
+
+                const bool bold = (spans[spanIndex].style & sf::Text::Bold) != 0;
+                const std::uint32_t curChar = text[j];
+                position.x += m_fontCached.getKerning(prevChar, curChar, m_textSize);
+                prevChar = curChar;
+
+                if (curChar == ' ')
+                    position.x += bold ? boldWhitespaceWidth : whitespaceWidth;
+                else if (curChar == '\t')
+                    position.x += (bold ? boldWhitespaceWidth : whitespaceWidth) * 4;
+                else if (curChar == '\n')
+                {
+                    finishRun();
+                    position = {0, position.y + m_lineSpacingCached};
+                    runStart = 0;
+                }
+                else
+                {
+                    const float italicShear = (spans[spanIndex].style & sf::Text::Italic) ? 0.209f : 0.f; // 12 degrees, as in sf::Text
+                    const sf::Glyph& glyph = m_fontCached.getGlyph(curChar, m_textSize, bold);
+                    addGlyphQuad(m_textVertices, position, color, glyph, italicShear);
+                    position.x += glyph.advance;
+                }
+            }
+
+            finishRun();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const ChatBox::LinkArea* ChatBox::getLinkAtPosition(Vector2f pos) const
+    {
+        if (m_linkAreas.empty() || (m_firstVisibleLine >= m_lines.size()))
+            return nullptr;
+
+        // Links can only be clicked inside the area where the text is drawn
+        pos -= getPosition() + m_bordersCached.getOffset() + Vector2f{m_paddingCached.getLeft(), m_paddingCached.getTop()};
+        const float visibleHeight = getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom();
+        if (!FloatRect{0, 0, getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - m_scroll->getSize().x, visibleHeight}.contains(pos))
+            return nullptr;
+
+        // Find the position relative to the first visible line, in the same way as the text is positioned in the draw function
+        pos.x -= Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+        pos.y += static_cast<float>(m_scroll->getValue()) - (m_lines[m_firstVisibleLine].top - m_lines.front().top);
+        if (!m_linesStartFromTop && (m_fullTextHeight + Text::getExtraVerticalPadding(m_textSize) < visibleHeight))
+            pos.y -= visibleHeight - m_fullTextHeight - Text::getExtraVerticalPadding(m_textSize);
+
+        for (const auto& linkArea : m_linkAreas)
+        {
+            if (linkArea.rect.contains(pos))
+                return &linkArea;
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal& ChatBox::getSignal(std::string signalName)
+    {
+        if (signalName == toLower(onLinkClick.getName()))
+            return onLinkClick;
+        else
+            return Widget::getSignal(std::move(signalName));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChatBox::rendererChanged(const std::string& property)
     {
         if (property == "borders")
@@ -447,16 +1039,12 @@ namespace tgui
             m_spriteBackground.setOpacity(m_opacityCached);
             m_scroll->setInheritedOpacity(m_opacityCached);
 
-            for (auto& line : m_lines)
-                line.text.setOpacity(m_opacityCached);
+            rebuildTextVertices();
         }
         else if (property == "font")
         {
             Widget::rendererChanged(property);
 
-            for (auto& line : m_lines)
-                line.text.setFont(m_fontCached);
-
             recalculateAllLines();
         }
         else
@@ -573,19 +1161,36 @@ namespace tgui
         states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop()});
 
         // Set the clipping for all draw calls that happen until this clipping object goes out of scope
-        const Clipping clipping{target, states, {}, {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - m_scroll->getSize().x,
-                                                     getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()}};
+        const float visibleHeight = getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom();
+        const Clipping clipping{target, states, {}, {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - m_scroll->getSize().x, visibleHeight}};
 
         states.transform.translate({Text::getExtraHorizontalPadding(m_fontCached, m_textSize), -static_cast<float>(m_scroll->getValue())});
 
         // Put the lines at the bottom of the chat box if needed
-        if (!m_linesStartFromTop && (m_fullTextHeight + Text::getExtraVerticalPadding(m_textSize) < getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()))
-            states.transform.translate(0, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - m_fullTextHeight - Text::getExtraVerticalPadding(m_textSize));
+        if (!m_linesStartFromTop && (m_fullTextHeight + Text::getExtraVerticalPadding(m_textSize) < visibleHeight))
+            states.transform.translate(0, visibleHeight - m_fullTextHeight - Text::getExtraVerticalPadding(m_textSize));
 
-        for (const auto& line : m_lines)
+        // The glyphs of all lines that intersect with the visible area are drawn at once
+        if ((m_textVertices.getVertexCount() > 0) && (m_firstVisibleLine < m_lines.size()))
         {
-            line.text.draw(target, states);
-            states.transform.translate(0, line.text.getSize().y);
+            states.transform.translate(0, m_lines[m_firstVisibleLine].top - m_lines.front().top);
+
+            // Round the position to avoid blurry text
+            const float* matrix = states.transform.getMatrix();
+            states.transform = sf::Transform{matrix[0], matrix[4], std::round(matrix[12]),
+                                             matrix[1], matrix[5], std::floor(matrix[13]),
+                                             matrix[3], matrix[7], matrix[15]};
+
+            states.texture = &m_fontCached.getTexture(m_textSize);
+            PrimitiveBatch::draw(target, m_textVertices, states);
+
+        #if SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR < 4
+            if (m_lineVertices.getVertexCount() > 0)
+            {
+                states.texture = nullptr;
+                PrimitiveBatch::draw(target, m_lineVertices, states);
+            }
+        #endif
         }
     }
 
@@ -25,6 +25,7 @@
 
 #include <TGUI/Widgets/CheckBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/PrimitiveBatch.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <cmath>
 
@@ -37,6 +38,7 @@ namespace tgui
     CheckBox::CheckBox()
     {
         m_type = "CheckBox";
+        m_drawnThroughPrimitiveBatch = true;
 
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
 
@@ -121,6 +123,7 @@ namespace tgui
             else
                 m_text.setStyle(m_textStyleCached);
 
+            invalidate();
             onCheck.emit(this, true);
         }
         else
@@ -257,7 +260,7 @@ namespace tgui
                     {{rightPoint.x - x, rightPoint.y - y}, checkColor}
                 };
 
-                target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+                PrimitiveBatch::draw(target, vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
             }
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getTop()});
@@ -51,6 +51,7 @@ namespace tgui
     ChildWindow::ChildWindow(const sf::String& title, unsigned int titleButtons)
     {
         m_type = "ChildWindow";
+        m_drawnThroughPrimitiveBatch = true;
         m_isolatedFocus = true;
         m_titleText.setFont(m_fontCached);
 
@@ -179,6 +180,10 @@ namespace tgui
                 buttonOffsetX += button->getSize().x + m_paddingBetweenButtonsCached;
             }
         }
+
+        // The title bar isn't part of the cached contents, so dragging the window doesn't require them to be drawn again
+        if (m_parent)
+            m_parent->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -270,6 +275,8 @@ namespace tgui
             m_titleText.setCharacterSize(m_titleTextSize);
         else
             m_titleText.setCharacterSize(Text::findBestTextSize(m_fontCached, m_titleBarHeightCached * 0.8f));
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -606,6 +613,10 @@ namespace tgui
                 if (!m_mouseHover)
                     mouseEnteredWidget();
 
+                // The buttons aren't children of the window, so the window has to check itself whether they changed
+                for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+                    button->markAsDrawn();
+
                 // Check if the mouse is on top of the title bar
                 if (FloatRect{m_bordersCached.getLeft(), m_bordersCached.getTop(), getSize().x, m_titleBarHeightCached}.contains(pos))
                 {
@@ -629,6 +640,12 @@ namespace tgui
                             button->mouseNoLongerOnWidget();
                     }
                 }
+
+                for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+                {
+                    if (button->isInvalidated())
+                        invalidate();
+                }
             }
         }
     }
@@ -641,8 +658,12 @@ namespace tgui
 
         for (const auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
         {
+            button->markAsDrawn();
             if (button->isVisible())
                 button->mouseNoLongerOnWidget();
+
+            if (button->isInvalidated())
+                invalidate();
         }
     }
 
@@ -984,13 +1005,17 @@ namespace tgui
             states.transform.translate({0, m_borderBelowTitleBarCached});
         }
 
-        // Draw the background
-        if (m_backgroundColorCached != Color::Transparent)
-            drawRectangleShape(target, states, getSize(), m_backgroundColorCached);
+        // Draw the background and the widgets in the child window, either directly or from the render cache
+        const auto drawContents = [this](sf::RenderTarget& contentsTarget, const sf::RenderStates& contentsStates){
+            if (m_backgroundColorCached != Color::Transparent)
+                drawRectangleShape(contentsTarget, contentsStates, getSize(), m_backgroundColorCached);
+
+            const Clipping clipping{contentsTarget, contentsStates, {}, {getSize()}};
+            drawWidgetContainer(&contentsTarget, contentsStates);
+        };
 
-        // Draw the widgets in the child window
-        const Clipping clipping{target, states, {}, {getSize()}};
-        drawWidgetContainer(&target, states);
+        if ((m_backgroundColorCached.getAlpha() < 255) || !drawCachedContents(target, states, getSize(), drawContents))
+            drawContents(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -34,6 +34,7 @@ namespace tgui
     ClickableWidget::ClickableWidget()
     {
         m_type = "ClickableWidget";
+        m_drawnThroughPrimitiveBatch = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,7 @@
 #include <TGUI/Container.hpp>
 #include <TGUI/Widgets/ComboBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/PrimitiveBatch.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 #include <TGUI/SignalImpl.hpp>
 
@@ -38,6 +39,7 @@ namespace tgui
     ComboBox::ComboBox()
     {
         m_type = "ComboBox";
+        m_drawnThroughPrimitiveBatch = true;
         m_draggableWidget = true;
         m_text.setFont(m_fontCached);
 
@@ -269,6 +271,7 @@ namespace tgui
     {
         const bool ret = m_listBox->setSelectedItem(itemName);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -278,6 +281,7 @@ namespace tgui
     {
         const bool ret = m_listBox->setSelectedItemById(id);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -287,6 +291,7 @@ namespace tgui
     {
         const bool ret = m_listBox->setSelectedItemByIndex(index);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -295,6 +300,7 @@ namespace tgui
     void ComboBox::deselectItem()
     {
         m_text.setString("");
+        invalidate();
         m_listBox->deselectItem();
     }
 
@@ -307,6 +313,7 @@ namespace tgui
         const bool ret = m_listBox->removeItem(itemName);
 
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
 
         // Shrink the list size
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
@@ -336,6 +343,7 @@ namespace tgui
         const bool ret = m_listBox->removeItemByIndex(index);
 
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
 
         // Shrink the list size
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
@@ -349,6 +357,7 @@ namespace tgui
     void ComboBox::removeAllItems()
     {
         m_text.setString("");
+        invalidate();
         m_listBox->removeAllItems();
 
         updateListBoxHeight();
@@ -388,6 +397,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItem(originalValue, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -397,6 +407,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemById(id, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -406,6 +417,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemByIndex(index, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -443,6 +455,7 @@ namespace tgui
     {
         m_listBox->setTextSize(textSize);
         m_text.setCharacterSize(m_listBox->getTextSize());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -824,6 +837,7 @@ namespace tgui
 
         m_listBox->connect("ItemSelected", [this](){
                                                 m_text.setString(m_listBox->getSelectedItem());
+                                                invalidate();
                                                 onItemSelect.emit(this, m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
                                             });
 
@@ -888,7 +902,7 @@ namespace tgui
             else
                 arrow.setFillColor(m_arrowColorCached);
 
-            target.draw(arrow, states);
+            PrimitiveBatch::draw(target, arrow, states);
         }
 
         // Draw the selected item
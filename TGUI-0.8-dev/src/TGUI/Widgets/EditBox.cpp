@@ -48,6 +48,7 @@ namespace tgui
     EditBox::EditBox()
     {
         m_type = "EditBox";
+        m_drawnThroughPrimitiveBatch = true;
         m_textBeforeSelection.setFont(m_fontCached);
         m_textSelection.setFont(m_fontCached);
         m_textAfterSelection.setFont(m_fontCached);
@@ -150,6 +151,7 @@ namespace tgui
         if (m_textSize == 0)
         {
             m_textFull.setCharacterSize(Text::findBestTextSize(m_fontCached, (getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()) * 0.8f));
+            m_characterPositionsOutdated = true;
             m_textBeforeSelection.setCharacterSize(m_textFull.getCharacterSize());
             m_textSelection.setCharacterSize(m_textFull.getCharacterSize());
             m_textAfterSelection.setCharacterSize(m_textFull.getCharacterSize());
@@ -158,6 +160,7 @@ namespace tgui
         else // When the text has a fixed size
         {
             m_textFull.setCharacterSize(m_textSize);
+            m_characterPositionsOutdated = true;
             m_textBeforeSelection.setCharacterSize(m_textSize);
             m_textSelection.setCharacterSize(m_textSize);
             m_textAfterSelection.setCharacterSize(m_textSize);
@@ -165,10 +168,8 @@ namespace tgui
         }
 
         // Change the text if allowed
-        if (m_regexString == ".*")
+        if (!m_inputValidator || m_inputValidator->isValid(text))
             m_text = text;
-        else if (std::regex_match(text.toAnsiString(), m_regex))
-            m_text = text.toAnsiString(); // Unicode is not supported when using regex because it can't be checked
         else // Clear the text
             m_text = "";
 
@@ -187,6 +188,8 @@ namespace tgui
         else
             m_textFull.setString(m_text);
 
+        m_characterPositionsOutdated = true;
+
         // Set the texts
         m_textBeforeSelection.setString(m_textFull.getString());
         m_textSelection.setString("");
@@ -206,6 +209,7 @@ namespace tgui
                 sf::String displayedString = m_textFull.getString();
                 displayedString.erase(displayedString.getSize()-1);
                 m_textFull.setString(displayedString);
+                m_characterPositionsOutdated = true;
                 m_text.erase(m_text.getSize()-1);
             }
 
@@ -242,6 +246,7 @@ namespace tgui
     void EditBox::setDefaultText(const sf::String& text)
     {
         m_defaultText.setString(text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -324,6 +329,7 @@ namespace tgui
             m_textSelection.setString("");
             m_textAfterSelection.setString("");
             m_textFull.setString(displayedText);
+            m_characterPositionsOutdated = true;
 
             // Set the caret behind the last character
             setCaretPosition(displayedText.getSize());
@@ -371,6 +377,7 @@ namespace tgui
                 sf::String displayedString = m_textFull.getString();
                 displayedString.erase(displayedString.getSize()-1);
                 m_textFull.setString(displayedString);
+                m_characterPositionsOutdated = true;
                 m_text.erase(m_text.getSize()-1);
             }
 
@@ -378,6 +385,7 @@ namespace tgui
 
             // There is no clipping
             m_textCropPosition = 0;
+            invalidate();
 
             // If the caret was behind the limit, then set it at the end
             if (m_selEnd > m_textFull.getString().getSize())
@@ -431,9 +439,27 @@ namespace tgui
 
     void EditBox::setInputValidator(const std::string& regex)
     {
+        if (regex == Validator::All)
+            m_inputValidator = nullptr;
+        else if (regex == Validator::Int)
+            m_inputValidator = std::make_shared<IntValidator>(true);
+        else if (regex == Validator::UInt)
+            m_inputValidator = std::make_shared<IntValidator>(false);
+        else if (regex == Validator::Float)
+            m_inputValidator = std::make_shared<FloatValidator>();
+        else
+            m_inputValidator = std::make_shared<RegexValidator>(regex);
+
         m_regexString = regex;
-        m_regex = m_regexString;
+        setText(m_text);
+    }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::setInputValidator(std::shared_ptr<InputValidator> validator)
+    {
+        m_inputValidator = std::move(validator);
+        m_regexString = m_inputValidator ? "" : Validator::All;
         setText(m_text);
     }
 
@@ -743,6 +769,7 @@ namespace tgui
                     sf::String displayedString = m_textFull.getString();
                     displayedString.erase(m_selEnd-1, 1);
                     m_textFull.setString(displayedString);
+                    m_characterPositionsOutdated = true;
                     m_text.erase(m_selEnd-1, 1);
 
                     // Set the caret back on the correct position
@@ -782,6 +809,7 @@ namespace tgui
                     sf::String displayedString = m_textFull.getString();
                     displayedString.erase(m_selEnd, 1);
                     m_textFull.setString(displayedString);
+                    m_characterPositionsOutdated = true;
                     m_text.erase(m_selEnd, 1);
 
                     // Set the caret back on the correct position
@@ -877,24 +905,9 @@ namespace tgui
         if (m_readOnly)
             return;
 
-        // Only add the character when the regex matches
-        if (m_regexString != ".*")
-        {
-            sf::String text = m_text;
-
-            if (m_selChars == 0)
-                text.insert(m_selEnd, key);
-            else
-            {
-                const std::size_t pos = std::min(m_selStart, m_selEnd);
-                text.erase(pos, m_selChars);
-                text.insert(pos, key);
-            }
-
-            // The character has to match the regex
-            if (!std::regex_match(text.toAnsiString(), m_regex))
-                return;
-        }
+        // Only add the character when the validator accepts it
+        if (m_inputValidator && !m_inputValidator->isValidInsertion(m_text, std::min(m_selStart, m_selEnd), m_selChars, key))
+            return;
 
         // If there are selected characters then delete them first
         if (m_selChars > 0)
@@ -915,6 +928,7 @@ namespace tgui
             displayedText.insert(m_selEnd, key);
 
         m_textFull.setString(displayedText);
+        m_characterPositionsOutdated = true;
 
         // When there is a text width limit then reverse what we just did
         if (m_limitTextWidth)
@@ -926,6 +940,7 @@ namespace tgui
                 m_text.erase(m_selEnd, 1);
                 displayedText.erase(m_selEnd, 1);
                 m_textFull.setString(displayedText);
+                m_characterPositionsOutdated = true;
                 return;
             }
         }
@@ -1010,6 +1025,7 @@ namespace tgui
             m_textAfterSelection.setStyle(style);
             m_textSelection.setStyle(style);
             m_textFull.setStyle(style);
+            m_characterPositionsOutdated = true;
         }
         else if (property == "defaulttextstyle")
         {
@@ -1085,6 +1101,7 @@ namespace tgui
             m_textSelection.setFont(m_fontCached);
             m_textAfterSelection.setFont(m_fontCached);
             m_textFull.setFont(m_fontCached);
+            m_characterPositionsOutdated = true;
             m_defaultText.setFont(m_fontCached);
 
             // Recalculate the text size and position
@@ -1108,7 +1125,7 @@ namespace tgui
                 node->propertyValuePairs["Alignment"] = std::make_unique<DataIO::ValueNode>("Right");
         }
 
-        if (getInputValidator() != ".*")
+        if (!getInputValidator().empty() && (getInputValidator() != ".*"))
         {
             if (getInputValidator() == EditBox::Validator::Int)
                 node->propertyValuePairs["InputValidator"] = std::make_unique<DataIO::ValueNode>("Int");
@@ -1228,44 +1245,21 @@ namespace tgui
             }
         }
 
-        float width = 0;
-        std::uint32_t prevChar = 0;
-        const unsigned int textSize = getTextSize();
-        const bool bold = (m_textFull.getStyle() & sf::Text::Bold) != 0;
-
-        std::size_t index;
-        for (index = 0; index < m_text.getSize(); ++index)
-        {
-            float charWidth;
-            std::uint32_t curChar = m_text[index];
-            if (curChar == '\n')
-            {
-                // This should not happen as edit box is for single line text, but lets try the next line anyway since we haven't found the position yet
-                width = 0;
-                prevChar = 0;
-                continue;
-            }
-            else if (curChar == '\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', textSize, bold).advance) * 4;
-            else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, textSize, bold).advance);
-
-            const float kerning = m_fontCached.getKerning(prevChar, curChar, textSize);
-            if (width + charWidth < posX)
-                width += charWidth + kerning;
-            else
-            {
-                // If the mouse is on the second halve of the character then the caret should be on the right of it
-                if (width + charWidth - posX < charWidth / 2.f)
-                    index++;
+        return Text::findCharacterIndex(getCharacterPositions(), posX);
+    }
 
-                break;
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            prevChar = curChar;
+    const std::vector<float>& EditBox::getCharacterPositions()
+    {
+        if (m_characterPositionsOutdated)
+        {
+            Text::calculateCharacterPositions(m_characterPositions, m_textFull.getString(), m_fontCached, m_textFull.getCharacterSize(),
+                                              (m_textFull.getStyle() & sf::Text::Bold) != 0);
+            m_characterPositionsOutdated = false;
         }
 
-        return index;
+        return m_characterPositions;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1282,6 +1276,7 @@ namespace tgui
         sf::String displayedString = m_textFull.getString();
         displayedString.erase(pos, m_selChars);
         m_textFull.setString(displayedString);
+        m_characterPositionsOutdated = true;
         m_text.erase(pos, m_selChars);
 
         // Set the caret back on the correct position
@@ -1330,35 +1325,45 @@ namespace tgui
         m_textBeforeSelection.setPosition(textX, textY);
         m_defaultText.setPosition(textX, textY);
 
+        const std::vector<float>& characterPositions = getCharacterPositions();
+
         // Check if there is a selection
         if (m_selChars != 0)
         {
+            const std::size_t selectionBegin = std::min(m_selStart, m_selEnd);
+            const std::size_t selectionEnd = std::max(m_selStart, m_selEnd);
+
             // Watch out for the kerning
-            if (m_textBeforeSelection.getString().getSize() > 0)
-                textX += m_fontCached.getKerning(m_textFull.getString()[m_textBeforeSelection.getString().getSize() - 1], m_textFull.getString()[m_textBeforeSelection.getString().getSize()], m_textBeforeSelection.getCharacterSize());
+            float kerningSelectionBegin = 0;
+            if (selectionBegin > 0)
+                kerningSelectionBegin = m_fontCached.getKerning(m_textFull.getString()[selectionBegin - 1], m_textFull.getString()[selectionBegin], m_textBeforeSelection.getCharacterSize());
+
+            textX += kerningSelectionBegin + characterPositions[selectionBegin];
 
-            textX += m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x;
+            // The selected text starts without kerning with the character in front of it
+            const float selectionWidth = characterPositions[selectionEnd] - characterPositions[selectionBegin] - kerningSelectionBegin;
 
             // Set the position and size of the rectangle that gets drawn behind the selected text
-            m_selectedTextBackground.setSize({m_textSelection.findCharacterPos(m_textSelection.getString().getSize()).x,
-                                              getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()});
+            m_selectedTextBackground.setSize({selectionWidth, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()});
             m_selectedTextBackground.setPosition({textX, m_paddingCached.getTop()});
 
             // Set the text selected text on the correct position
             m_textSelection.setPosition(textX, textY);
 
             // Watch out for kerning
-            if (m_textFull.getString().getSize() > m_textBeforeSelection.getString().getSize() + m_textSelection.getString().getSize())
-                textX += m_fontCached.getKerning(m_textFull.getString()[m_textBeforeSelection.getString().getSize() + m_textSelection.getString().getSize() - 1], m_textFull.getString()[m_textBeforeSelection.getString().getSize() + m_textSelection.getString().getSize()], m_textBeforeSelection.getCharacterSize());
+            if (m_textFull.getString().getSize() > selectionEnd)
+                textX += m_fontCached.getKerning(m_textFull.getString()[selectionEnd - 1], m_textFull.getString()[selectionEnd], m_textBeforeSelection.getCharacterSize());
 
             // Set the text selected text on the correct position
-            textX += m_textSelection.findCharacterPos(m_textSelection.getString().getSize()).x;
+            textX += selectionWidth;
             m_textAfterSelection.setPosition(textX, textY);
         }
 
         // Set the position of the caret
-        caretLeft += m_textFull.findCharacterPos(m_selEnd).x - (m_caret.getSize().x * 0.5f);
+        caretLeft += characterPositions[m_selEnd] - (m_caret.getSize().x * 0.5f);
         m_caret.setPosition({caretLeft, m_paddingCached.getTop()});
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1404,7 +1409,7 @@ namespace tgui
         if (!m_limitTextWidth)
         {
             // Find out the position of the caret
-            const float caretPosition = m_textFull.findCharacterPos(m_selEnd).x;
+            const float caretPosition = getCharacterPositions()[m_selEnd];
 
             // If the caret is too far on the right then adjust the cropping
             if (m_textCropPosition + getVisibleEditBoxWidth() - (2 * Text::getExtraHorizontalPadding(m_textFull)) < caretPosition)
@@ -1456,6 +1461,10 @@ namespace tgui
 
             // Too slow for double clicking
             m_possibleDoubleClick = false;
+
+            // The caret is only drawn while the edit box is focused
+            if (m_focused)
+                invalidate();
         }
     }
 
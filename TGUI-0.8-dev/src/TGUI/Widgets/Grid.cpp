@@ -35,6 +35,7 @@ namespace tgui
     Grid::Grid()
     {
         m_type = "Grid";
+        m_drawnThroughPrimitiveBatch = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
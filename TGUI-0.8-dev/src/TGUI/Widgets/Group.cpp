@@ -35,6 +35,7 @@ namespace tgui
     Group::Group(const Layout2d& size)
     {
         m_type = "Group";
+        m_drawnThroughPrimitiveBatch = true;
 
         m_renderer = aurora::makeCopied<GroupRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
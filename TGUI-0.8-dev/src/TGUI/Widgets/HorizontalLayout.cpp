@@ -36,6 +36,7 @@ namespace tgui
         BoxLayoutRatios{size}
     {
         m_type = "HorizontalLayout";
+        m_drawnThroughPrimitiveBatch = true;
 
         m_renderer = aurora::makeCopied<BoxLayoutRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Knob.hpp>
+#include <TGUI/PrimitiveBatch.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
 #include <cmath>
 
@@ -43,6 +44,7 @@ namespace tgui
     Knob::Knob()
     {
         m_type = "Knob";
+        m_drawnThroughPrimitiveBatch = true;
         m_draggableWidget = true;
 
         m_renderer = aurora::makeCopied<KnobRenderer>();
@@ -457,6 +459,8 @@ namespace tgui
         {
             m_angle = (((m_value - m_minimum) / static_cast<float>(m_maximum - m_minimum)) * allowedAngle) + m_startRotation;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -576,7 +580,7 @@ namespace tgui
             bordersShape.setFillColor(Color::Transparent);
             bordersShape.setOutlineColor(Color::calcColorOpacity(m_borderColorCached, m_opacityCached));
             bordersShape.setOutlineThickness(borderThickness);
-            target.draw(bordersShape, states);
+            PrimitiveBatch::draw(target, bordersShape, states);
         }
 
         // Draw the background
@@ -586,7 +590,7 @@ namespace tgui
         {
             sf::CircleShape background{size / 2};
             background.setFillColor(Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached));
-            target.draw(background, states);
+            PrimitiveBatch::draw(target, background, states);
         }
 
         // Draw the foreground
@@ -608,7 +612,7 @@ namespace tgui
             thumb.setFillColor(Color::calcColorOpacity(m_thumbColorCached, m_opacityCached));
             thumb.setPosition({(size / 2.0f) - thumb.getRadius() + (std::cos(m_angle / 180 * pi) * (size / 2) * 3/5),
                                (size / 2.0f) - thumb.getRadius() + (-std::sin(m_angle / 180 * pi) * (size / 2) * 3/5)});
-            target.draw(thumb, states);
+            PrimitiveBatch::draw(target, thumb, states);
         }
     }
 
@@ -26,6 +26,7 @@
 #include <TGUI/Widgets/Label.hpp>
 #include <TGUI/Clipping.hpp>
 
+#include <algorithm>
 #include <cmath>
 
 #ifdef TGUI_USE_CPP17
@@ -41,6 +42,7 @@ namespace tgui
     Label::Label()
     {
         m_type = "Label";
+        m_drawnThroughPrimitiveBatch = true;
 
         m_renderer = aurora::makeCopied<LabelRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -116,7 +118,11 @@ namespace tgui
 
     void Label::setText(const sf::String& string)
     {
+        if (string == m_string)
+            return;
+
         m_string = string;
+        m_linesOutdated = true;
         rearrangeText();
     }
 
@@ -134,6 +140,7 @@ namespace tgui
         if (size != m_textSize)
         {
             m_textSize = size;
+            m_linePropertiesOutdated = true;
             rearrangeText();
         }
     }
@@ -297,6 +304,7 @@ namespace tgui
         else if (property == "textstyle")
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
+            m_linePropertiesOutdated = true;
             rearrangeText();
         }
         else if (property == "textcolor")
@@ -316,6 +324,7 @@ namespace tgui
         else if (property == "font")
         {
             Widget::rendererChanged(property);
+            m_linePropertiesOutdated = true;
             rearrangeText();
         }
         else if (property == "opacity")
@@ -416,10 +425,14 @@ namespace tgui
 
     void Label::rearrangeText()
     {
-        m_lines.clear();
+        invalidate();
 
         if (m_fontCached == nullptr)
+        {
+            m_lines.clear();
+            m_linesOutdated = true;
             return;
+        }
 
         const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize, m_textStyleCached);
 
@@ -431,37 +444,37 @@ namespace tgui
         {
             maxWidth = getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight() - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2*textOffset;
             if (maxWidth <= 0)
+            {
+                m_lines.clear();
+                m_linesOutdated = true;
                 return;
+            }
         }
 
-        // Fit the text in the available space
-        const sf::String string = Text::wordWrap(maxWidth, m_string, m_fontCached, m_textSize, m_textStyleCached & sf::Text::Bold);
-
-        // Split the string in multiple lines
-        float width = 0;
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        while (newLinePos != sf::String::InvalidPos)
+        // The existing texts are reused, they only need to be changed when the properties of the text changed
+        if (m_linePropertiesOutdated)
         {
-            newLinePos = string.find('\n', searchPosStart);
+            for (auto& line : m_lines)
+            {
+                line.setCharacterSize(getTextSize());
+                line.setFont(m_fontCached);
+                line.setStyle(m_textStyleCached);
+            }
 
-            m_lines.emplace_back();
-            m_lines.back().setCharacterSize(getTextSize());
-            m_lines.back().setFont(m_fontCached);
-            m_lines.back().setStyle(m_textStyleCached);
-            m_lines.back().setColor(m_textColorCached);
-            m_lines.back().setOpacity(m_opacityCached);
+            m_linePropertiesOutdated = false;
+            m_linesOutdated = true;
+        }
 
-            if (newLinePos != sf::String::InvalidPos)
-                m_lines.back().setString(string.substring(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.back().setString(string.substring(searchPosStart));
+        // Fit the text in the available space
+        if (m_linesOutdated || ((maxWidth != m_wrappedWidth) && !isWrappedForWidth(maxWidth)))
+            updateLines(maxWidth);
 
-            if (m_lines.back().getSize().x > width)
-                width = m_lines.back().getSize().x;
+        m_wrappedWidth = maxWidth;
+        m_linesOutdated = false;
 
-            searchPosStart = newLinePos + 1;
-        }
+        float width = 0;
+        for (const auto& line : m_lines)
+            width = std::max(width, line.getSize().x);
 
         const Outline outline = {m_paddingCached.getLeft() + m_bordersCached.getLeft(),
                                  m_paddingCached.getTop() + m_bordersCached.getTop(),
@@ -532,6 +545,74 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Label::updateLines(float maxWidth)
+    {
+        // A text without newlines doesn't have to be word-wrapped when it fits on a single line
+        if (std::find(m_string.begin(), m_string.end(), '\n') == m_string.end())
+        {
+            resizeLines(1);
+            if (m_lines[0].getString() != m_string)
+                m_lines[0].setString(m_string);
+
+            if ((maxWidth == 0) || (m_lines[0].getSize().x <= maxWidth))
+            {
+                m_wrappedLines.assign(1, {0, m_string.getSize(), m_lines[0].getSize().x});
+                return;
+            }
+        }
+
+        Text::wordWrap(m_wrappedLines, maxWidth, m_string, m_fontCached, m_textSize, m_textStyleCached & sf::Text::Bold);
+
+        // Only the lines that changed are given a new string
+        resizeLines(m_wrappedLines.size());
+        for (std::size_t i = 0; i < m_wrappedLines.size(); ++i)
+        {
+            const Text::WrappedLine& wrappedLine = m_wrappedLines[i];
+            const sf::String& oldString = m_lines[i].getString();
+            if ((oldString.getSize() != wrappedLine.end - wrappedLine.begin)
+             || !std::equal(oldString.begin(), oldString.end(), m_string.begin() + wrappedLine.begin))
+            {
+                m_lines[i].setString(m_string.substring(wrappedLine.begin, wrappedLine.end - wrappedLine.begin));
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Label::resizeLines(std::size_t lineCount)
+    {
+        const std::size_t oldLineCount = m_lines.size();
+        m_lines.resize(lineCount);
+
+        for (std::size_t i = oldLineCount; i < lineCount; ++i)
+        {
+            m_lines[i].setCharacterSize(getTextSize());
+            m_lines[i].setFont(m_fontCached);
+            m_lines[i].setStyle(m_textStyleCached);
+            m_lines[i].setColor(m_textColorCached);
+            m_lines[i].setOpacity(m_opacityCached);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Label::isWrappedForWidth(float maxWidth) const
+    {
+        // When every line ends with a newline and still fits, then word-wrapping the text again would give the same lines
+        for (std::size_t i = 0; i < m_wrappedLines.size(); ++i)
+        {
+            if ((i + 1 < m_wrappedLines.size()) && (m_string[m_wrappedLines[i].end] != '\n'))
+                return false;
+
+            if ((maxWidth != 0) && (m_wrappedLines[i].width > maxWidth))
+                return false;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(std::round(getPosition().x), std::round(getPosition().y));
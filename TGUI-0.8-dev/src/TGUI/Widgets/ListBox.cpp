@@ -35,6 +35,7 @@ namespace tgui
     ListBox::ListBox()
     {
         m_type = "ListBox";
+        m_drawnThroughPrimitiveBatch = true;
 
         m_draggableWidget = true;
 
@@ -102,6 +103,7 @@ namespace tgui
             m_items[i].setPosition({0, (i * m_itemHeight) + ((m_itemHeight - m_items[i].getSize().y) / 2.0f)});
 
         m_scroll->setPosition(getSize().x - m_bordersCached.getRight() - m_scroll->getSize().x, m_bordersCached.getTop());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -147,6 +149,8 @@ namespace tgui
             // Add the new item to the list
             m_items.push_back(std::move(newItem));
             m_itemIds.push_back(id);
+
+            invalidate();
             return true;
         }
         else // The item limit was reached
@@ -201,6 +205,7 @@ namespace tgui
         else if ((m_selectedItem + 1) * getItemHeight() > m_scroll->getValue() + m_scroll->getViewportSize())
             m_scroll->setValue((m_selectedItem + 1) * getItemHeight() - m_scroll->getViewportSize());
 
+        invalidate();
         return true;
     }
 
@@ -279,6 +284,7 @@ namespace tgui
         m_itemIds.clear();
 
         m_scroll->setMaximum(0);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -349,6 +355,7 @@ namespace tgui
             return false;
 
         m_items[index].setString(newValue);
+        invalidate();
         return true;
     }
 
@@ -567,12 +574,11 @@ namespace tgui
         if (!m_mouseHover)
             mouseEnteredWidget();
 
-        updateHoveringItem(-1);
-
         // Check if the mouse event should go to the scrollbar
         if ((m_scroll->isMouseDown() && m_scroll->isMouseDownOnThumb()) || m_scroll->mouseOnWidget(pos))
         {
             m_scroll->mouseMoved(pos);
+            updateHoveringItem(-1);
         }
         else // Mouse not on scrollbar or dragging the scrollbar thumb
         {
@@ -601,7 +607,12 @@ namespace tgui
                     }
                 }
             }
+            else
+                updateHoveringItem(-1);
         }
+
+        if (m_scroll->hasHoverChanged())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -623,6 +634,8 @@ namespace tgui
     {
         Widget::mouseNoLongerOnWidget();
         m_scroll->mouseNoLongerOnWidget();
+        if (m_scroll->hasHoverChanged())
+            invalidate();
 
         updateHoveringItem(-1);
 
@@ -887,6 +900,8 @@ namespace tgui
             if (m_textColorHoverCached.isSet())
                 m_items[m_hoveringItem].setColor(m_textColorHoverCached);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -36,6 +36,7 @@ namespace tgui
     MenuBar::MenuBar()
     {
         m_type = "MenuBar";
+        m_drawnThroughPrimitiveBatch = true;
         m_distanceToSideCached = Text::getLineHeight(m_fontCached, getGlobalTextSize()) * 0.4f;
 
         m_renderer = aurora::makeCopied<MenuBarRenderer>();
@@ -111,6 +112,7 @@ namespace tgui
         newMenu.text.setCharacterSize(m_textSize);
         newMenu.text.setString(text);
         m_menus.push_back(std::move(newMenu));
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -131,6 +133,7 @@ namespace tgui
                 menuItem.setString(text);
 
                 m_menus[i].menuItems.push_back(std::move(menuItem));
+                invalidate();
                 return true;
             }
         }
@@ -165,6 +168,7 @@ namespace tgui
                 if (m_visibleMenu == static_cast<int>(i))
                     m_visibleMenu = -1;
 
+                invalidate();
                 return true;
             }
         }
@@ -194,6 +198,7 @@ namespace tgui
                         if (m_menus[i].selectedMenuItem == static_cast<int>(j))
                             m_menus[i].selectedMenuItem = -1;
 
+                        invalidate();
                         return true;
                     }
                 }
@@ -209,6 +214,7 @@ namespace tgui
     void MenuBar::removeAllMenus()
     {
         m_menus.clear();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -224,6 +230,8 @@ namespace tgui
 
             m_menus[i].text.setCharacterSize(m_textSize);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -238,6 +246,7 @@ namespace tgui
     void MenuBar::setMinimumSubMenuWidth(float minimumWidth)
     {
         m_minimumSubMenuWidth = minimumWidth;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -252,6 +261,7 @@ namespace tgui
     void MenuBar::setInvertedMenuDirection(bool invertDirection)
     {
         m_invertedMenuDirection = invertDirection;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -295,6 +305,7 @@ namespace tgui
 
             m_menus[m_visibleMenu].text.setColor(m_textColorCached);
             m_visibleMenu = -1;
+            invalidate();
         }
     }
 
@@ -424,6 +435,9 @@ namespace tgui
         if (!m_mouseHover)
             mouseEnteredWidget();
 
+        const int oldVisibleMenu = m_visibleMenu;
+        const int oldSelectedMenuItem = (m_visibleMenu != -1) ? m_menus[m_visibleMenu].selectedMenuItem : -1;
+
         // Check if the mouse is on top of the menu bar (not on an open menus)
         if (FloatRect{0, 0, getSize().x, getSize().y}.contains(pos))
         {
@@ -492,6 +506,11 @@ namespace tgui
                     m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_textColorCached);
             }
         }
+
+        // The menu only has to be drawn again when a different menu was opened or another menu item is below the mouse
+        const int selectedMenuItem = (m_visibleMenu != -1) ? m_menus[m_visibleMenu].selectedMenuItem : -1;
+        if ((m_visibleMenu != oldVisibleMenu) || (selectedMenuItem != oldSelectedMenuItem))
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,6 +35,7 @@ namespace tgui
     MessageBox::MessageBox()
     {
         m_type = "MessageBox";
+        m_drawnThroughPrimitiveBatch = true;
 
         m_renderer = aurora::makeCopied<MessageBoxRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
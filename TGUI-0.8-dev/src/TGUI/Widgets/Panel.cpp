@@ -35,6 +35,7 @@ namespace tgui
     Panel::Panel(const Layout2d& size)
     {
         m_type = "Panel";
+        m_drawnThroughPrimitiveBatch = true;
         m_isolatedFocus = true;
 
         m_renderer = aurora::makeCopied<PanelRenderer>();
@@ -193,18 +194,22 @@ namespace tgui
             states.transform.translate({m_bordersCached.getLeft(), m_bordersCached.getTop()});
         }
 
-        // Draw the background
+        // Draw the background and the child widgets, either directly or from the render cache
         const Vector2f innerSize = {getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
                                         getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()};
-        drawRectangleShape(target, states, innerSize, m_backgroundColorCached);
+        const auto drawContents = [this, innerSize](sf::RenderTarget& contentsTarget, sf::RenderStates contentsStates){
+            drawRectangleShape(contentsTarget, contentsStates, innerSize, m_backgroundColorCached);
 
-        states.transform.translate(m_paddingCached.getLeft(), m_paddingCached.getTop());
-        const Vector2f contentSize = {innerSize.x - m_paddingCached.getLeft() - m_paddingCached.getRight(),
-                                          innerSize.y - m_paddingCached.getTop() - m_paddingCached.getBottom()};
+            contentsStates.transform.translate(m_paddingCached.getLeft(), m_paddingCached.getTop());
+            const Vector2f contentSize = {innerSize.x - m_paddingCached.getLeft() - m_paddingCached.getRight(),
+                                              innerSize.y - m_paddingCached.getTop() - m_paddingCached.getBottom()};
 
-        // Draw the child widgets
-        const Clipping clipping{target, states, {}, contentSize};
-        drawWidgetContainer(&target, states);
+            const Clipping clipping{contentsTarget, contentsStates, {}, contentSize};
+            drawWidgetContainer(&contentsTarget, contentsStates);
+        };
+
+        if ((m_backgroundColorCached.getAlpha() < 255) || !drawCachedContents(target, states, innerSize, drawContents))
+            drawContents(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,6 +35,7 @@ namespace tgui
     ProgressBar::ProgressBar()
     {
         m_type = "ProgressBar";
+        m_drawnThroughPrimitiveBatch = true;
         m_textBack.setFont(m_fontCached);
         m_textFront.setFont(m_fontCached);
 
@@ -234,6 +235,7 @@ namespace tgui
         }
 
         m_textFront.setCharacterSize(m_textBack.getCharacterSize());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -474,6 +476,8 @@ namespace tgui
 
         if (m_spriteFill.isSet())
             m_spriteFill.setVisibleRect(m_frontRect);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,7 @@
 
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/PrimitiveBatch.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
 
 namespace tgui
@@ -34,6 +35,7 @@ namespace tgui
     RadioButton::RadioButton()
     {
         m_type = "RadioButton";
+        m_drawnThroughPrimitiveBatch = true;
         m_text.setFont(m_fontCached);
 
         m_renderer = aurora::makeCopied<RadioButtonRenderer>();
@@ -151,6 +153,8 @@ namespace tgui
             m_text.setStyle(m_textStyleCheckedCached);
         else
             m_text.setStyle(m_textStyleCached);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -165,6 +169,8 @@ namespace tgui
             m_text.setCharacterSize(Text::findBestTextSize(m_fontCached, getSize().y * 0.8f));
         else
             m_text.setCharacterSize(m_textSize);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -659,7 +665,7 @@ namespace tgui
             circle.setOutlineThickness(-m_bordersCached.getLeft());
             circle.setFillColor(Color::Transparent);
             circle.setOutlineColor(Color::calcColorOpacity(getCurrentBorderColor(), m_opacityCached));
-            target.draw(circle, states);
+            PrimitiveBatch::draw(target, circle, states);
         }
 
         // Draw the box
@@ -693,7 +699,7 @@ namespace tgui
         {
             sf::CircleShape circle{innerRadius};
             circle.setFillColor(Color::calcColorOpacity(getCurrentBackgroundColor(), m_opacityCached));
-            target.draw(circle, states);
+            PrimitiveBatch::draw(target, circle, states);
 
             // Draw the check if the radio button is checked
             if (m_checked)
@@ -701,7 +707,7 @@ namespace tgui
                 sf::CircleShape checkShape{innerRadius * 0.4f};
                 checkShape.setFillColor(Color::calcColorOpacity(getCurrentCheckColor(), m_opacityCached));
                 checkShape.setPosition({innerRadius - checkShape.getRadius(), innerRadius - checkShape.getRadius()});
-                target.draw(checkShape, states);
+                PrimitiveBatch::draw(target, checkShape, states);
             }
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getLeft()});
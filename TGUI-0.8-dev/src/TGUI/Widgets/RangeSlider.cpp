@@ -35,6 +35,7 @@ namespace tgui
     RangeSlider::RangeSlider()
     {
         m_type = "RangeSlider";
+        m_drawnThroughPrimitiveBatch = true;
 
         m_draggableWidget = true;
 
@@ -632,6 +633,8 @@ namespace tgui
             m_thumbs.second.left = (innerSize.x / (m_maximum - m_minimum) * (m_selectionEnd - m_minimum)) - (m_thumbs.second.width / 2.0f);
             m_thumbs.second.top = m_bordersCached.getTop() + (innerSize.y - m_thumbs.second.height) / 2.0f;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
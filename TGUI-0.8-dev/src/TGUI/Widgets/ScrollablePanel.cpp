@@ -40,6 +40,7 @@ namespace tgui
         Panel{size}
     {
         m_type = "ScrollablePanel";
+        m_drawnThroughPrimitiveBatch = true;
 
         m_renderer = aurora::makeCopied<ScrollablePanelRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -430,6 +431,12 @@ namespace tgui
             m_verticalScrollbar->mouseNoLongerOnWidget();
             m_horizontalScrollbar->mouseNoLongerOnWidget();
         }
+
+        // Both calls are needed to remember the state of each scrollbar
+        const bool verticalHoverChanged = m_verticalScrollbar->hasHoverChanged();
+        const bool horizontalHoverChanged = m_horizontalScrollbar->hasHoverChanged();
+        if (verticalHoverChanged || horizontalHoverChanged)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -455,6 +462,11 @@ namespace tgui
         Panel::mouseNoLongerOnWidget();
         m_verticalScrollbar->mouseNoLongerOnWidget();
         m_horizontalScrollbar->mouseNoLongerOnWidget();
+
+        const bool verticalHoverChanged = m_verticalScrollbar->hasHoverChanged();
+        const bool horizontalHoverChanged = m_horizontalScrollbar->hasHoverChanged();
+        if (verticalHoverChanged || horizontalHoverChanged)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -644,6 +656,8 @@ namespace tgui
 
         const float horizontalSpeed = 40.f * (static_cast<float>(m_horizontalScrollbar->getMaximum() - m_horizontalScrollbar->getViewportSize()) / m_horizontalScrollbar->getViewportSize());
         m_horizontalScrollbar->setScrollAmount(static_cast<unsigned int>(std::ceil(std::sqrt(horizontalSpeed))));
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/PrimitiveBatch.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,6 +36,7 @@ namespace tgui
     Scrollbar::Scrollbar()
     {
         m_type = "Scrollbar";
+        m_drawnThroughPrimitiveBatch = true;
 
         m_draggableWidget = true;
 
@@ -322,6 +324,7 @@ namespace tgui
     void Scrollbar::setAutoHide(bool autoHide)
     {
         m_autoHide = autoHide;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -508,6 +511,8 @@ namespace tgui
         if (!m_mouseHover)
             mouseEnteredWidget();
 
+        const Part oldHoverPart = m_mouseHoverOverPart;
+
         // Check if the mouse button went down on top of the track (or thumb)
         if (m_mouseDown && !m_mouseDownOnArrow)
         {
@@ -661,6 +666,9 @@ namespace tgui
             m_mouseHoverOverPart = Part::ArrowUp;
         else if (FloatRect{m_arrowDown.left, m_arrowDown.top, m_arrowDown.width, m_arrowDown.height}.contains(pos))
             m_mouseHoverOverPart = Part::ArrowDown;
+
+        if (m_mouseHoverOverPart != oldHoverPart)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -833,6 +841,8 @@ namespace tgui
             m_thumb.left = m_track.left + ((m_track.width - m_thumb.width) * m_value / (m_maximum - m_viewportSize));
             m_thumb.top = 0;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -883,7 +893,7 @@ namespace tgui
                 arrow.setPoint(2, {m_arrowUp.width * 4/5, m_arrowUp.height * 4/5});
             }
 
-            target.draw(arrow, states);
+            PrimitiveBatch::draw(target, arrow, states);
         }
 
         // Draw the track
@@ -957,7 +967,7 @@ namespace tgui
                 arrow.setPoint(2, {m_arrowDown.width / 5, m_arrowDown.height * 4/5});
             }
 
-            target.draw(arrow, states);
+            PrimitiveBatch::draw(target, arrow, states);
         }
     }
 
@@ -984,6 +994,18 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ScrollbarChildWidget::hasHoverChanged()
+    {
+        // The part below the mouse only matters while the mouse is on top of the scrollbar
+        const bool changed = (m_mouseHover != m_previousMouseHover) || (m_mouseHover && (m_mouseHoverOverPart != m_previousHoverPart));
+
+        m_previousMouseHover = m_mouseHover;
+        m_previousHoverPart = m_mouseHoverOverPart;
+        return changed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
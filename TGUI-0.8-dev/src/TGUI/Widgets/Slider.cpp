@@ -35,6 +35,7 @@ namespace tgui
     Slider::Slider()
     {
         m_type = "Slider";
+        m_drawnThroughPrimitiveBatch = true;
 
         m_draggableWidget = true;
 
@@ -593,6 +594,8 @@ namespace tgui
             if (m_invertedDirection)
                 m_thumb.left = getSize().x - m_thumb.left - m_thumb.width;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -23,6 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Widgets/SpinButton.hpp>
+#include <TGUI/PrimitiveBatch.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <cmath>
@@ -36,6 +37,7 @@ namespace tgui
     SpinButton::SpinButton()
     {
         m_type = "SpinButton";
+        m_drawnThroughPrimitiveBatch = true;
 
         m_renderer = aurora::makeCopied<SpinButtonRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -281,6 +283,8 @@ namespace tgui
 
     void SpinButton::mouseMoved(Vector2f pos)
     {
+        const bool oldMouseHoverOnTopArrow = m_mouseHoverOnTopArrow;
+
         // Check if the mouse is on top of the upper/right arrow
         if (m_verticalScroll)
         {
@@ -297,6 +301,9 @@ namespace tgui
                 m_mouseHoverOnTopArrow = false;
         }
 
+        if (m_mouseHoverOnTopArrow != oldMouseHoverOnTopArrow)
+            invalidate();
+
         if (!m_mouseHover)
             mouseEnteredWidget();
     }
@@ -469,8 +476,8 @@ namespace tgui
             else
                 arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            PrimitiveBatch::draw(target, arrowBack, states);
+            PrimitiveBatch::draw(target, arrow, states);
         }
 
         // Draw the space between the arrows (if there is space)
@@ -535,8 +542,8 @@ namespace tgui
             else
                 arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            PrimitiveBatch::draw(target, arrowBack, states);
+            PrimitiveBatch::draw(target, arrow, states);
         }
     }
 
@@ -39,6 +39,7 @@ namespace tgui
     Tabs::Tabs()
     {
         m_type = "Tabs";
+        m_drawnThroughPrimitiveBatch = true;
         m_distanceToSideCached = Text::getLineHeight(m_fontCached, getGlobalTextSize()) * 0.4f;
 
         m_renderer = aurora::makeCopied<TabsRenderer>();
@@ -237,6 +238,7 @@ namespace tgui
         // Select the tab
         m_selectedTab = static_cast<int>(index);
         m_tabs[m_selectedTab].text.setColor(m_selectedTextColorCached);
+        invalidate();
 
         // Send the callback
         onTabSelect.emit(this, m_tabs[index].text.getString());
@@ -250,6 +252,7 @@ namespace tgui
             m_tabs[m_selectedTab].text.setColor(m_textColorCached);
 
         m_selectedTab = -1;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -285,6 +288,8 @@ namespace tgui
 
         // New hovered tab depends on several factors, we keep it simple and just remove the hover state
         m_hoveringTab = -1;
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -473,6 +478,7 @@ namespace tgui
         Widget::mouseMoved(pos);
 
         pos -= getPosition();
+        const int oldHoveringTab = m_hoveringTab;
         m_hoveringTab = -1;
         float width = m_bordersCached.getLeft() / 2.f;
 
@@ -493,6 +499,9 @@ namespace tgui
                 break;
             }
         }
+
+        if (m_hoveringTab != oldHoveringTab)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -501,7 +510,11 @@ namespace tgui
     {
         Widget::mouseNoLongerOnWidget();
 
-        m_hoveringTab = -1;
+        if (m_hoveringTab != -1)
+        {
+            m_hoveringTab = -1;
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -549,6 +562,7 @@ namespace tgui
         }
 
         m_bordersCached.updateParentSize(getSize());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -787,6 +801,8 @@ namespace tgui
             if (m_textColorHoverCached.isSet())
                 m_tabs[m_hoveringTab].text.setColor(m_textColorHoverCached);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,17 +28,25 @@
 #include <TGUI/Widgets/TextBox.hpp>
 #include <TGUI/Clipping.hpp>
 
+#include <algorithm>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Amount of lines above and below the visible area that are also placed in the text objects
+        const std::size_t ExtraRenderedLines = 10;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     TextBox::TextBox()
     {
         m_type = "TextBox";
+        m_drawnThroughPrimitiveBatch = true;
         m_draggableWidget = true;
         m_textBeforeSelection.setFont(m_fontCached);
         m_textSelection1.setFont(m_fontCached);
@@ -132,9 +140,12 @@ namespace tgui
     {
         // Remove all the excess characters when a character limit is set
         if ((m_maxChars > 0) && (text.getSize() > m_maxChars))
-            m_text = text.substring(0, m_maxChars);
+            m_textAsString = text.substring(0, m_maxChars);
         else
-            m_text = text;
+            m_textAsString = text;
+
+        m_text = m_textAsString;
+        m_textAsStringOutdated = false;
 
         rearrangeText(false);
     }
@@ -143,14 +154,28 @@ namespace tgui
 
     void TextBox::addText(const sf::String& text)
     {
-        setText(m_text + text);
+        // Remove all the excess characters when a character limit is set
+        std::size_t count = text.getSize();
+        if (m_maxChars > 0)
+            count = std::min(count, m_maxChars - std::min(m_maxChars, m_text.getSize()));
+
+        // Only the last paragraph and the added text have to be wrapped, the caret is placed at the back of the text
+        const std::size_t pos = m_text.getSize();
+        m_text.insert(pos, (count < text.getSize()) ? text.substring(0, count) : text);
+        rearrangeChangedText(pos, 0, count, pos + count, pos + count);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     const sf::String& TextBox::getText() const
     {
-        return m_text;
+        if (m_textAsStringOutdated)
+        {
+            m_textAsString = m_text.toString();
+            m_textAsStringOutdated = false;
+        }
+
+        return m_textAsString;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -184,6 +209,10 @@ namespace tgui
         m_lineHeight = static_cast<unsigned int>(m_fontCached.getLineSpacing(m_textSize));
 
         m_verticalScroll->setScrollAmount(m_lineHeight);
+        m_renderedLinesOutdated = true;
+
+        for (auto& positions : m_lineCharacterPositions)
+            positions.clear();
 
         rearrangeText(true);
     }
@@ -207,6 +236,7 @@ namespace tgui
         {
             // Remove all the excess characters
             m_text.erase(m_maxChars, sf::String::InvalidPos);
+            m_textAsStringOutdated = true;
             rearrangeText(false);
         }
     }
@@ -250,24 +280,11 @@ namespace tgui
             charactersBeforeCaret = m_text.getSize();
 
         // Find the line and position on that line on which the caret is located
-        std::size_t count = 0;
-        for (std::size_t i = 0; i < m_lines.size(); ++i)
+        if (!m_wrappedLines.empty())
         {
-            if (count + m_lines[i].getSize() < charactersBeforeCaret)
-            {
-                count += m_lines[i].getSize();
-                if ((count < m_text.getSize()) && (m_text[count] == '\n'))
-                    count += 1;
-            }
-            else
-            {
-                m_selStart.y = i;
-                m_selStart.x = charactersBeforeCaret - count;
-
-                m_selEnd = m_selStart;
-                updateSelectionTexts();
-                break;
-            }
+            m_selStart = findLinePosition(charactersBeforeCaret);
+            m_selEnd = m_selStart;
+            updateSelectionTexts();
         }
     }
 
@@ -457,6 +474,9 @@ namespace tgui
         {
             m_verticalScroll->mouseMoved(pos);
             recalculateVisibleLines();
+
+            if (m_verticalScroll->hasHoverChanged())
+                invalidate();
         }
 
         // If the mouse is held down then you are selecting text
@@ -490,7 +510,11 @@ namespace tgui
             mouseLeftWidget();
 
         if (m_verticalScroll->isShown())
+        {
             m_verticalScroll->mouseNoLongerOnWidget();
+            if (m_verticalScroll->hasHoverChanged())
+                invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -777,35 +801,10 @@ namespace tgui
                     const std::size_t pos = findTextSelectionPositions().second;
                     if (pos > 0)
                     {
-                        if (m_selEnd.x > 0)
-                        {
-                            // There is a specific case that we have to watch out for. When we are removing the last character on
-                            // a line which was placed there by word wrap and a newline follows this character then the caret
-                            // has to be placed at the line above (before the newline) instead of at the same line (after the newline)
-                            if ((m_lines[m_selEnd.y].getSize() == 1) && (pos > 1) && (pos < m_text.getSize()) && (m_text[pos-2] != '\n') && (m_text[pos] == '\n') && (m_selEnd.y > 0))
-                            {
-                                m_selEnd.y--;
-                                m_selEnd.x = m_lines[m_selEnd.y].getSize();
-                            }
-                            else // Just remove the character normally
-                                --m_selEnd.x;
-                        }
-                        else // At the beginning of the line
-                        {
-                            if (m_selEnd.y > 0)
-                            {
-                                --m_selEnd.y;
-                                m_selEnd.x = m_lines[m_selEnd.y].getSize();
-
-                                if ((m_text[pos-1] != '\n') && m_selEnd.x > 0)
-                                    --m_selEnd.x;
-                            }
-                        }
-
-                        m_selStart = m_selEnd;
-
+                        // When the removed character was the only one on a line that was placed there by word wrap and a newline
+                        // follows it, then the caret ends up at the line above (before the newline) instead of after the newline
                         m_text.erase(pos - 1, 1);
-                        rearrangeText(true);
+                        rearrangeChangedText(pos - 1, 1, 0, pos - 1, pos - 1);
                     }
                 }
                 else // When you did select some characters then delete them
@@ -815,7 +814,7 @@ namespace tgui
                 m_caretVisible = true;
                 m_animationTimeElapsed = {};
 
-                onTextChange.emit(this, m_text);
+                emitTextChanged();
                 break;
             }
 
@@ -827,13 +826,17 @@ namespace tgui
                 // Check that we did not select any characters
                 if (m_selStart == m_selEnd)
                 {
-                    m_text.erase(findTextSelectionPositions().second, 1);
-                    rearrangeText(true);
+                    const std::size_t pos = findTextSelectionPositions().second;
+                    if (pos < m_text.getSize())
+                    {
+                        m_text.erase(pos, 1);
+                        rearrangeChangedText(pos, 1, 0, pos, pos);
+                    }
                 }
                 else // You did select some characters, so remove them
                     deleteSelectedCharacters();
 
-                onTextChange.emit(this, m_text);
+                emitTextChanged();
                 break;
             }
 
@@ -887,14 +890,13 @@ namespace tgui
                     {
                         deleteSelectedCharacters();
 
-                        m_text.insert(findTextSelectionPositions().first, clipboardContents);
-                        m_lines[m_selStart.y].insert(m_selStart.x, clipboardContents);
+                        const std::size_t pos = findTextSelectionPositions().first;
+                        m_text.insert(pos, clipboardContents);
 
-                        m_selStart.x += clipboardContents.getSize();
-                        m_selEnd = m_selStart;
-                        rearrangeText(true);
+                        const std::size_t caretPosition = pos + clipboardContents.getSize();
+                        rearrangeChangedText(pos, 0, clipboardContents.getSize(), caretPosition, caretPosition);
 
-                        onTextChange.emit(this, m_text);
+                        emitTextChanged();
                     }
                 }
 
@@ -928,16 +930,13 @@ namespace tgui
             const std::size_t caretPosition = findTextSelectionPositions().first;
 
             m_text.insert(caretPosition, key);
-            m_lines[m_selEnd.y].insert(m_selEnd.x, key);
 
             // Increment the caret position, unless you type a newline at the start of a line while that line only existed due to word wrapping
+            std::size_t newCaretPosition = caretPosition;
             if ((key != '\n') || (m_selEnd.x > 0) || (m_selEnd.y == 0) || m_lines[m_selEnd.y-1].isEmpty() || (m_text[caretPosition-1] == '\n'))
-            {
-                m_selStart.x++;
-                m_selEnd.x++;
-            }
+                newCaretPosition++;
 
-            rearrangeText(true);
+            rearrangeChangedText(caretPosition, 0, 1, newCaretPosition, newCaretPosition);
         };
 
         // If there is a scrollbar then inserting can't go wrong
@@ -948,21 +947,19 @@ namespace tgui
         else // There is no scrollbar, the text may not fit
         {
             // Store the data so that it can be reverted
-            sf::String oldText = m_text;
-            const auto oldSelStart = m_selStart;
-            const auto oldSelEnd = m_selEnd;
+            const auto oldSelectionPositions = findTextSelectionPositions();
+            const sf::String oldSelectedText = getSelectedText();
 
             // Try to insert the character
             insert();
 
-            // Undo the insert if the text does not fit
+            // Undo the insert if the text does not fit, by removing the character and putting back the selected text
             if (m_lines.size() > getInnerSize().y / m_lineHeight)
             {
-                m_text = oldText;
-                m_selStart = oldSelStart;
-                m_selEnd = oldSelEnd;
-
-                rearrangeText(true);
+                const std::size_t pos = std::min(oldSelectionPositions.first, oldSelectionPositions.second);
+                m_text.erase(pos, 1);
+                m_text.insert(pos, oldSelectedText);
+                rearrangeChangedText(pos, 1, oldSelectedText.getSize(), oldSelectionPositions.first, oldSelectionPositions.second);
             }
         }
 
@@ -970,7 +967,7 @@ namespace tgui
         m_caretVisible = true;
         m_animationTimeElapsed = {};
 
-        onTextChange.emit(this, m_text);
+        emitTextChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1017,57 +1014,36 @@ namespace tgui
             return sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
 
         // Find between which character the mouse is standing
-        float width = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
-        std::uint32_t prevChar = 0;
-        for (std::size_t i = 0; i < m_lines[lineNumber].getSize(); ++i)
-        {
-            float charWidth;
-            const std::uint32_t curChar = m_lines[lineNumber][i];
-            //if (curChar == '\n')
-            //    return sf::Vector2f<std::size_t>(m_lines[lineNumber].getSize() - 1, lineNumber); // TextBox strips newlines but this code is kept for when this function is generalized
-            //else
-            if (curChar == '\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', getTextSize(), false).advance) * 4;
-            else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, getTextSize(), false).advance);
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+        return {Text::findCharacterIndex(getLineCharacterPositions(lineNumber), position.x - textOffset), lineNumber};
+    }
 
-            const float kerning = m_fontCached.getKerning(prevChar, curChar, getTextSize());
-            if (width + charWidth + kerning <= position.x)
-                width += charWidth + kerning;
-            else
-            {
-                if (position.x < width + kerning + (charWidth / 2.0f))
-                    return {i, lineNumber};
-                else
-                    return {i + 1, lineNumber};
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            prevChar = curChar;
-        }
+    const std::vector<float>& TextBox::getLineCharacterPositions(std::size_t line) const
+    {
+        std::vector<float>& positions = m_lineCharacterPositions[line];
+        if (positions.empty())
+            Text::calculateCharacterPositions(positions, m_lines[line], m_fontCached, m_textSize, false);
 
-        // You clicked behind the last character
-        return sf::Vector2<std::size_t>(m_lines[lineNumber].getSize(), lineNumber);
+        return positions;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::pair<std::size_t, std::size_t> TextBox::findTextSelectionPositions() const
     {
-        // This function is used to count the amount of characters spread over several lines
-        auto findIndex = [this](std::size_t line)
+        // The word-wrapped lines know where they start in the text
+        auto findIndex = [this](std::size_t line) -> std::size_t
         {
-            std::size_t counter = 0;
-            for (std::size_t i = 0; i < line; ++i)
-            {
-                counter += m_lines[i].getSize();
-                if ((counter < m_text.getSize()) && (m_text[counter] == '\n'))
-                    counter += 1;
-            }
-
-            return counter;
+            if (line < m_wrappedLines.size())
+                return m_wrappedLines[line].begin;
+            else
+                return 0;
         };
 
-        return {findIndex(m_selStart.y) + m_selStart.x, findIndex(m_selEnd.y) + m_selEnd.x};
+        return {std::min(findIndex(m_selStart.y) + m_selStart.x, m_text.getSize()),
+                std::min(findIndex(m_selEnd.y) + m_selEnd.x, m_text.getSize())};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1078,118 +1054,183 @@ namespace tgui
         {
             auto textSelectionPositions = findTextSelectionPositions();
 
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-            {
-                m_text.erase(textSelectionPositions.second, textSelectionPositions.first - textSelectionPositions.second);
-                m_selStart = m_selEnd;
-            }
-            else
-            {
-                m_text.erase(textSelectionPositions.first, textSelectionPositions.second - textSelectionPositions.first);
-                m_selEnd = m_selStart;
-            }
+            if (textSelectionPositions.first > textSelectionPositions.second)
+                std::swap(textSelectionPositions.first, textSelectionPositions.second);
 
-            rearrangeText(true);
+            const std::size_t count = textSelectionPositions.second - textSelectionPositions.first;
+            m_text.erase(textSelectionPositions.first, count);
+            rearrangeChangedText(textSelectionPositions.first, count, 0, textSelectionPositions.first, textSelectionPositions.first);
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::rearrangeText(bool keepSelection)
+    {
+        if (keepSelection)
+        {
+            const auto textSelectionPositions = findTextSelectionPositions();
+            rearrangeText(textSelectionPositions.first, textSelectionPositions.second);
+        }
+        else // Set the caret at the back of the text
+            rearrangeText(m_text.getSize(), m_text.getSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::rearrangeText(std::size_t selStart, std::size_t selEnd)
     {
         // Don't continue when line height is 0 or when there is no font yet
         if ((m_lineHeight == 0) || (m_fontCached == nullptr))
+        {
+            m_wrappedLines.clear();
             return;
-
-        // Find the maximum width of one line
-        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
-        float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
-        if (m_verticalScroll->isShown())
-            maxLineWidth -= m_verticalScroll->getSize().x;
+        }
 
         // Don't do anything when there is no room for the text
+        const float maxLineWidth = getMaximumLineWidth();
         if (maxLineWidth <= 0)
+        {
+            m_wrappedLines.clear();
             return;
-
-        // Store the current selection position when we are keeping the selection
-        std::pair<std::size_t, std::size_t> textSelectionPositions;
-        if (keepSelection)
-            textSelectionPositions = findTextSelectionPositions();
+        }
 
         // Fit the text in the available space
-        const sf::String string = Text::wordWrap(maxLineWidth, m_text, m_fontCached, m_textSize, false, false);
+        const sf::String& text = getText();
+        Text::wordWrap(m_wrappedLines, maxLineWidth, text, m_fontCached, m_textSize, false, false);
 
         // Split the string in multiple lines
         m_lines.clear();
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        while (newLinePos != sf::String::InvalidPos)
-        {
-            newLinePos = string.find('\n', searchPosStart);
+        for (const auto& line : m_wrappedLines)
+            m_lines.push_back(text.substring(line.begin, line.end - line.begin));
 
-            if (newLinePos != sf::String::InvalidPos)
-                m_lines.push_back(string.substring(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.push_back(string.substring(searchPosStart));
+        m_lineCharacterPositions.clear();
+        m_lineCharacterPositions.resize(m_lines.size());
 
-            searchPosStart = newLinePos + 1;
-        }
+        finishRearrangeText(selStart, selEnd);
+    }
 
-        // Check if we should try to keep our selection
-        if (keepSelection)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::rearrangeChangedText(std::size_t pos, std::size_t erasedCount, std::size_t insertedCount, std::size_t selStart, std::size_t selEnd)
+    {
+        m_textAsStringOutdated = true;
+
+        // Without a previous layout, the whole text has to be wrapped
+        const float maxLineWidth = getMaximumLineWidth();
+        if ((m_lineHeight == 0) || (m_fontCached == nullptr) || (maxLineWidth <= 0) || m_wrappedLines.empty())
         {
-            std::size_t index = 0;
-            sf::Vector2<std::size_t> newSelStart;
-            sf::Vector2<std::size_t> newSelEnd;
-            bool newSelStartFound = false;
-            bool newSelEndFound = false;
-
-            // Look for the new locations of our selection
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
-            {
-                index += m_lines[i].getSize();
+            rearrangeText(selStart, selEnd);
+            return;
+        }
 
-                if (!newSelStartFound && (index >= textSelectionPositions.first))
-                {
-                    newSelStart = sf::Vector2<std::size_t>(m_lines[i].getSize() - (index - textSelectionPositions.first), i);
+        // The lines are wrapped again from the start of the paragraph in which the change starts, because removing characters
+        // may allow a word to move to the line above. Lines in other paragraphs aren't affected by the change, so only the text
+        // up to the end of the paragraph in which the change ends is needed.
+        const std::size_t changeEnd = pos + insertedCount;
+        const std::size_t rangeBegin = m_text.getLineStart(m_text.getLineIndex(pos));
+        const std::size_t rangeEnd = m_text.getLineStart(m_text.getLineIndex(changeEnd) + 1);
+        m_changedText = m_text.substring(rangeBegin, rangeEnd - rangeBegin);
+
+        const auto lineIt = std::lower_bound(m_wrappedLines.begin(), m_wrappedLines.end(), rangeBegin,
+                                             [](const Text::WrappedLine& line, std::size_t position){ return line.begin < position; });
+        if ((lineIt == m_wrappedLines.end()) || (lineIt->begin != rangeBegin))
+        {
+            rearrangeText(selStart, selEnd);
+            return;
+        }
 
-                    newSelStartFound = true;
-                    if (newSelEndFound)
-                        break;
-                }
+        // Where a line ends only depends on the text after its start, so once a line starts after the changed characters
+        // at the same place as one of the old lines, all remaining lines are still correct.
+        const std::size_t firstLine = static_cast<std::size_t>(lineIt - m_wrappedLines.begin());
+        std::size_t oldLine = firstLine;
+        std::size_t lastChangedLine = m_wrappedLines.size();
+        std::size_t begin = rangeBegin;
+        m_changedLines.clear();
+        while (begin < m_text.getSize())
+        {
+            if (begin >= changeEnd)
+            {
+                const std::size_t oldBegin = begin + erasedCount - insertedCount;
+                while ((oldLine < m_wrappedLines.size()) && (m_wrappedLines[oldLine].begin < oldBegin))
+                    ++oldLine;
 
-                if (!newSelEndFound && (index >= textSelectionPositions.second))
+                if ((oldLine < m_wrappedLines.size()) && (m_wrappedLines[oldLine].begin == oldBegin))
                 {
-                    newSelEnd = sf::Vector2<std::size_t>(m_lines[i].getSize() - (index - textSelectionPositions.second), i);
-
-                    newSelEndFound = true;
-                    if (newSelStartFound)
-                        break;
+                    lastChangedLine = oldLine;
+                    break;
                 }
-
-                // Skip newlines in the text
-                if (m_text[index] == '\n')
-                    ++index;
             }
 
-            // Keep the selection when possible
-            if (newSelStartFound && newSelEndFound)
+            // The next paragraph always starts at the same place as one of the old lines
+            if (begin >= rangeEnd)
             {
-                m_selStart = newSelStart;
-                m_selEnd = newSelEnd;
-            }
-            else // The text has changed too much, the selection can't be kept
-            {
-                m_selStart = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
-                m_selEnd = m_selStart;
+                rearrangeText(selStart, selEnd);
+                return;
             }
+
+            Text::WrappedLine line = Text::wordWrapLine(maxLineWidth, m_changedText, begin - rangeBegin, m_fontCached, m_textSize, false, false);
+            line.begin += rangeBegin;
+            line.end += rangeBegin;
+            m_changedLines.push_back(line);
+
+            begin = line.end;
+            if ((begin < rangeEnd) && (m_changedText[begin - rangeBegin] == '\n'))
+                ++begin;
         }
-        else // Set the caret at the back of the text
+
+        // There is an empty line at the end when the text ends with a newline
+        if ((begin == m_text.getSize()) && (m_text.isEmpty() || (m_text[m_text.getSize()-1] == '\n')))
+            m_changedLines.push_back({begin, begin, 0});
+
+        // The lines behind the changed part stay the same, but they are moved in the text
+        for (std::size_t i = lastChangedLine; i < m_wrappedLines.size(); ++i)
         {
-            m_selStart = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
-            m_selEnd = m_selStart;
+            m_wrappedLines[i].begin = m_wrappedLines[i].begin + insertedCount - erasedCount;
+            m_wrappedLines[i].end = m_wrappedLines[i].end + insertedCount - erasedCount;
+        }
+
+        // Replace the changed lines
+        const std::size_t oldLineCount = lastChangedLine - firstLine;
+        if (m_changedLines.size() > oldLineCount)
+        {
+            m_wrappedLines.insert(m_wrappedLines.begin() + lastChangedLine, m_changedLines.size() - oldLineCount, Text::WrappedLine{});
+            m_lines.insert(m_lines.begin() + lastChangedLine, m_changedLines.size() - oldLineCount, sf::String{});
+            m_lineCharacterPositions.insert(m_lineCharacterPositions.begin() + lastChangedLine, m_changedLines.size() - oldLineCount, std::vector<float>{});
+        }
+        else if (m_changedLines.size() < oldLineCount)
+        {
+            m_wrappedLines.erase(m_wrappedLines.begin() + firstLine + m_changedLines.size(), m_wrappedLines.begin() + lastChangedLine);
+            m_lines.erase(m_lines.begin() + firstLine + m_changedLines.size(), m_lines.begin() + lastChangedLine);
+            m_lineCharacterPositions.erase(m_lineCharacterPositions.begin() + firstLine + m_changedLines.size(), m_lineCharacterPositions.begin() + lastChangedLine);
+        }
+
+        for (std::size_t i = 0; i < m_changedLines.size(); ++i)
+        {
+            const Text::WrappedLine& line = m_changedLines[i];
+            m_wrappedLines[firstLine + i] = line;
+            m_lines[firstLine + i] = m_changedText.substring(line.begin - rangeBegin, line.end - line.begin);
+            m_lineCharacterPositions[firstLine + i].clear();
         }
 
+        finishRearrangeText(selStart, selEnd);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::emitTextChanged()
+    {
+        if (onTextChange.hasHandlers())
+            onTextChange.emit(this, getText());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::finishRearrangeText(std::size_t selStart, std::size_t selEnd)
+    {
+        m_selStart = findLinePosition(selStart);
+        m_selEnd = findLinePosition(selEnd);
+
         // Tell the scrollbar how many pixels the text contains
         const bool scrollbarShown = m_verticalScroll->isShown();
 
@@ -1200,82 +1241,49 @@ namespace tgui
         // We may have to recalculate what we just calculated if the scrollbar just appeared or disappeared
         if (scrollbarShown != m_verticalScroll->isShown())
         {
-            rearrangeText(true);
+            rearrangeText(selStart, selEnd);
             return;
         }
 
+        m_renderedLinesOutdated = true;
         updateSelectionTexts();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBox::updateSelectionTexts()
+    sf::Vector2<std::size_t> TextBox::findLinePosition(std::size_t textPosition) const
     {
-        // If there is no selection then just put the whole text in m_textBeforeSelection
-        if (m_selStart == m_selEnd)
-        {
-            sf::String displayedText;
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
-                displayedText += m_lines[i] + "\n";
+        if (m_wrappedLines.empty())
+            return {0, 0};
 
-            m_textBeforeSelection.setString(displayedText);
-            m_textSelection1.setString("");
-            m_textSelection2.setString("");
-            m_textAfterSelection1.setString("");
-            m_textAfterSelection2.setString("");
-        }
-        else // Some text is selected
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
-            // Set the text before the selection
-            if (selectionStart.y > 0)
-            {
-                sf::String string;
-                for (std::size_t i = 0; i < selectionStart.y; ++i)
-                    string += m_lines[i] + "\n";
-
-                string += m_lines[selectionStart.y].substring(0, selectionStart.x);
-                m_textBeforeSelection.setString(string);
-            }
-            else
-                m_textBeforeSelection.setString(m_lines[0].substring(0, selectionStart.x));
+        textPosition = std::min(textPosition, m_text.getSize());
 
-            // Set the selected text
-            if (m_selStart.y == m_selEnd.y)
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, selectionEnd.x - selectionStart.x));
-                m_textSelection2.setString("");
-            }
-            else
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, m_lines[selectionStart.y].getSize() - selectionStart.x));
+        // The position belongs to the first line that doesn't end before it, so that a position where a line was split by the
+        // word-wrap is placed at the end of the upper line
+        const auto lineIt = std::lower_bound(m_wrappedLines.begin(), m_wrappedLines.end(), textPosition,
+                                             [](const Text::WrappedLine& line, std::size_t position){ return line.end < position; });
+        if (lineIt == m_wrappedLines.end())
+            return {m_lines.back().getSize(), m_lines.size() - 1};
 
-                sf::String string;
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                    string += m_lines[i] + "\n";
-
-                string += m_lines[selectionEnd.y].substring(0, selectionEnd.x);
+        return {textPosition - lineIt->begin, static_cast<std::size_t>(lineIt - m_wrappedLines.begin())};
+    }
 
-                m_textSelection2.setString(string);
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // Set the text after the selection
-            {
-                m_textAfterSelection1.setString(m_lines[selectionEnd.y].substring(selectionEnd.x, m_lines[selectionEnd.y].getSize() - selectionEnd.x));
+    float TextBox::getMaximumLineWidth() const
+    {
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+        float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
+        if (m_verticalScroll->isShown())
+            maxLineWidth -= m_verticalScroll->getSize().x;
 
-                sf::String string;
-                for (std::size_t i = selectionEnd.y + 1; i < m_lines.size(); ++i)
-                    string += m_lines[i] + "\n";
+        return maxLineWidth;
+    }
 
-                m_textAfterSelection2.setString(string);
-            }
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::updateSelectionTexts()
+    {
         // Check if the caret is located above or below the view
         if (isVerticalScrollbarPresent())
         {
@@ -1316,6 +1324,10 @@ namespace tgui
 
             // Too slow for double clicking
             m_possibleDoubleClick = false;
+
+            // The caret is only drawn while the text box is focused
+            if (m_focused)
+                invalidate();
         }
     }
 
@@ -1326,99 +1338,15 @@ namespace tgui
         if (!m_fontCached)
             return;
 
-        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
-        sf::Text tempText{"", *m_fontCached.getFont(), getTextSize()};
-
         // Position the caret
         {
-            tempText.setString(m_lines[m_selEnd.y].substring(0, m_selEnd.x));
+            const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
 
             float kerning = 0;
             if ((m_selEnd.x > 0) && (m_selEnd.x < m_lines[m_selEnd.y].getSize()))
                 kerning = m_fontCached.getKerning(m_lines[m_selEnd.y][m_selEnd.x-1], m_lines[m_selEnd.y][m_selEnd.x], m_textSize);
 
-            m_caretPosition = {textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerning, static_cast<float>(m_selEnd.y * m_lineHeight)};
-        }
-
-        // Calculate the position of the text objects
-        m_selectionRects.clear();
-        m_textBeforeSelection.setPosition({textOffset, 0});
-        if (m_selStart != m_selEnd)
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
-            float kerningSelectionStart = 0;
-            if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].getSize()))
-                kerningSelectionStart = m_fontCached.getKerning(m_lines[selectionStart.y][selectionStart.x-1], m_lines[selectionStart.y][selectionStart.x], m_textSize);
-
-            float kerningSelectionEnd = 0;
-            if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].getSize()))
-                kerningSelectionEnd = m_fontCached.getKerning(m_lines[selectionEnd.y][selectionEnd.x-1], m_lines[selectionEnd.y][selectionEnd.x], m_textSize);
-
-            if (selectionStart.x > 0)
-            {
-                m_textSelection1.setPosition({textOffset + m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x + kerningSelectionStart,
-                                              m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-            }
-            else
-                m_textSelection1.setPosition({textOffset, m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-
-            m_textSelection2.setPosition({textOffset, static_cast<float>((selectionStart.y + 1) * m_lineHeight)});
-
-            if (!m_textSelection2.getString().isEmpty() || (selectionEnd.x == 0))
-            {
-                m_textAfterSelection1.setPosition({textOffset + m_textSelection2.findCharacterPos(m_textSelection2.getString().getSize()).x + kerningSelectionEnd,
-                                                   m_textSelection2.getPosition().y + ((selectionEnd.y - selectionStart.y - 1) * m_lineHeight)});
-            }
-            else
-                m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x + kerningSelectionEnd,
-                                                   m_textSelection1.getPosition().y});
-
-            m_textAfterSelection2.setPosition({textOffset, static_cast<float>((selectionEnd.y + 1) * m_lineHeight)});
-
-            // Recalculate the selection rectangles
-            {
-                m_selectionRects.push_back({m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y * m_lineHeight), 0, static_cast<float>(m_lineHeight)});
-
-                if (!m_lines[selectionStart.y].isEmpty())
-                {
-                    m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x;
-
-                    // There is kerning when the selection is on just this line
-                    if (selectionStart.y == selectionEnd.y)
-                        m_selectionRects.back().width += kerningSelectionEnd;
-                }
-
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                {
-                    m_selectionRects.back().width += textOffset;
-                    m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(i * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
-
-                    if (!m_lines[i].isEmpty())
-                    {
-                        tempText.setString(m_lines[i]);
-                        m_selectionRects.back().width += tempText.findCharacterPos(tempText.getString().getSize()).x;
-                    }
-                }
-
-                if (selectionStart.y != selectionEnd.y)
-                {
-                    m_selectionRects.back().width += textOffset;
-
-                    if (m_textSelection2.getString() != "")
-                    {
-                        tempText.setString(m_lines[selectionEnd.y].substring(0, selectionEnd.x));
-                        m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(selectionEnd.y * m_lineHeight),
-                                                    textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerningSelectionEnd, static_cast<float>(m_lineHeight)});
-                    }
-                    else
-                        m_selectionRects.push_back({0, static_cast<float>(selectionEnd.y * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
-                }
-            }
+            m_caretPosition = {textOffset + getLineCharacterPositions(m_selEnd.y)[m_selEnd.x] + kerning, static_cast<float>(m_selEnd.y * m_lineHeight)};
         }
 
         recalculateVisibleLines();
@@ -1446,6 +1374,158 @@ namespace tgui
             m_topLine = 0;
             m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()) / m_lineHeight), m_lines.size());
         }
+
+        updateVisibleTexts();
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::updateVisibleTexts()
+    {
+        if (!m_fontCached || m_lines.empty())
+            return;
+
+        // Nothing has to be done when the lines on the screen were already placed in the text objects and neither the
+        // lines nor the selection changed since then
+        const std::size_t firstVisibleLine = std::min(m_topLine, m_lines.size() - 1);
+        const std::size_t lastVisibleLine = std::min(m_topLine + m_visibleLines, m_lines.size());
+        const bool selectionChanged = (m_selStart != m_selEnd) ? ((m_selStart != m_renderedSelStart) || (m_selEnd != m_renderedSelEnd))
+                                                               : (m_renderedSelStart != m_renderedSelEnd);
+        if (!m_renderedLinesOutdated && !selectionChanged && (firstVisibleLine >= m_renderedLinesBegin) && (lastVisibleLine <= m_renderedLinesEnd))
+            return;
+
+        // Only the visible lines and a few lines above and below them are put in the text objects, so that the amount of
+        // vertices doesn't depend on the length of the text and scrolling a bit doesn't require changing the text objects
+        m_renderedLinesBegin = (firstVisibleLine > ExtraRenderedLines) ? (firstVisibleLine - ExtraRenderedLines) : 0;
+        m_renderedLinesEnd = std::min(lastVisibleLine + ExtraRenderedLines, m_lines.size());
+        m_renderedSelStart = m_selStart;
+        m_renderedSelEnd = m_selEnd;
+        m_renderedLinesOutdated = false;
+
+        const auto joinLines = [this](std::size_t begin, std::size_t end){
+            sf::String string;
+            for (std::size_t i = begin; i < end; ++i)
+                string += m_lines[i] + "\n";
+            return string;
+        };
+
+        auto selectionStart = m_selStart;
+        auto selectionEnd = m_selEnd;
+        if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+            std::swap(selectionStart, selectionEnd);
+
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+        m_textBeforeSelection.setPosition({textOffset, static_cast<float>(m_renderedLinesBegin * m_lineHeight)});
+        m_selectionRects.clear();
+
+        // If there is no selection on the rendered lines then just put all these lines in m_textBeforeSelection
+        if ((m_selStart == m_selEnd) || (selectionEnd.y < m_renderedLinesBegin) || (selectionStart.y >= m_renderedLinesEnd))
+        {
+            m_textBeforeSelection.setString(joinLines(m_renderedLinesBegin, m_renderedLinesEnd));
+            m_textSelection1.setString("");
+            m_textSelection2.setString("");
+            m_textAfterSelection1.setString("");
+            m_textAfterSelection2.setString("");
+            return;
+        }
+
+        // The parts of the selection that lie outside the rendered lines are cut off
+        if (selectionStart.y < m_renderedLinesBegin)
+            selectionStart = {0, m_renderedLinesBegin};
+        if (selectionEnd.y >= m_renderedLinesEnd)
+            selectionEnd = {m_lines[m_renderedLinesEnd - 1].getSize(), m_renderedLinesEnd - 1};
+
+        // Set the text before the selection
+        m_textBeforeSelection.setString(joinLines(m_renderedLinesBegin, selectionStart.y) + m_lines[selectionStart.y].substring(0, selectionStart.x));
+
+        // Set the selected text
+        if (selectionStart.y == selectionEnd.y)
+        {
+            m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, selectionEnd.x - selectionStart.x));
+            m_textSelection2.setString("");
+        }
+        else
+        {
+            m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, m_lines[selectionStart.y].getSize() - selectionStart.x));
+            m_textSelection2.setString(joinLines(selectionStart.y + 1, selectionEnd.y) + m_lines[selectionEnd.y].substring(0, selectionEnd.x));
+        }
+
+        // Set the text after the selection
+        m_textAfterSelection1.setString(m_lines[selectionEnd.y].substring(selectionEnd.x, m_lines[selectionEnd.y].getSize() - selectionEnd.x));
+        m_textAfterSelection2.setString(joinLines(selectionEnd.y + 1, m_renderedLinesEnd));
+
+        // Calculate the position of the text objects
+        float kerningSelectionStart = 0;
+        if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].getSize()))
+            kerningSelectionStart = m_fontCached.getKerning(m_lines[selectionStart.y][selectionStart.x-1], m_lines[selectionStart.y][selectionStart.x], m_textSize);
+
+        float kerningSelectionEnd = 0;
+        if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].getSize()))
+            kerningSelectionEnd = m_fontCached.getKerning(m_lines[selectionEnd.y][selectionEnd.x-1], m_lines[selectionEnd.y][selectionEnd.x], m_textSize);
+
+        // The widths of the pieces of the lines are taken from the positions of the characters within their line
+        const std::vector<float>& selectionStartLinePositions = getLineCharacterPositions(selectionStart.y);
+        const std::vector<float>& selectionEndLinePositions = getLineCharacterPositions(selectionEnd.y);
+        const float selection1Width = ((selectionStart.y == selectionEnd.y) ? selectionStartLinePositions[selectionEnd.x] : selectionStartLinePositions.back())
+                                      - selectionStartLinePositions[selectionStart.x] - kerningSelectionStart;
+
+        if (selectionStart.x > 0)
+        {
+            m_textSelection1.setPosition({textOffset + selectionStartLinePositions[selectionStart.x] + kerningSelectionStart,
+                                          static_cast<float>(selectionStart.y * m_lineHeight)});
+        }
+        else
+            m_textSelection1.setPosition({textOffset, static_cast<float>(selectionStart.y * m_lineHeight)});
+
+        m_textSelection2.setPosition({textOffset, static_cast<float>((selectionStart.y + 1) * m_lineHeight)});
+
+        if (!m_textSelection2.getString().isEmpty() || (selectionEnd.x == 0))
+        {
+            m_textAfterSelection1.setPosition({textOffset + selectionEndLinePositions[selectionEnd.x] + kerningSelectionEnd,
+                                               m_textSelection2.getPosition().y + ((selectionEnd.y - selectionStart.y - 1) * m_lineHeight)});
+        }
+        else
+            m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + selection1Width + kerningSelectionEnd,
+                                               m_textSelection1.getPosition().y});
+
+        m_textAfterSelection2.setPosition({textOffset, static_cast<float>((selectionEnd.y + 1) * m_lineHeight)});
+
+        // Recalculate the selection rectangles
+        {
+            m_selectionRects.push_back({m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y * m_lineHeight), 0, static_cast<float>(m_lineHeight)});
+
+            if (!m_lines[selectionStart.y].isEmpty())
+            {
+                m_selectionRects.back().width = selection1Width;
+
+                // There is kerning when the selection is on just this line
+                if (selectionStart.y == selectionEnd.y)
+                    m_selectionRects.back().width += kerningSelectionEnd;
+            }
+
+            for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
+            {
+                m_selectionRects.back().width += textOffset;
+                m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(i * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
+
+                if (!m_lines[i].isEmpty())
+                    m_selectionRects.back().width += getLineCharacterPositions(i).back();
+            }
+
+            if (selectionStart.y != selectionEnd.y)
+            {
+                m_selectionRects.back().width += textOffset;
+
+                if (m_textSelection2.getString() != "")
+                {
+                    m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(selectionEnd.y * m_lineHeight),
+                                                textOffset + selectionEndLinePositions[selectionEnd.x] + kerningSelectionEnd, static_cast<float>(m_lineHeight)});
+                }
+                else
+                    m_selectionRects.push_back({0, static_cast<float>(selectionEnd.y * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
+            }
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
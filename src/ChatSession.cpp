@@ -0,0 +1,219 @@
+#include "ChatSession.hpp"
+
+
+namespace
+{
+    void appendFrameHeader(std::string& buffer, std::uint32_t length)
+    {
+        buffer.push_back(static_cast<char>((length >> 24) & 0xFF));
+        buffer.push_back(static_cast<char>((length >> 16) & 0xFF));
+        buffer.push_back(static_cast<char>((length >> 8) & 0xFF));
+        buffer.push_back(static_cast<char>(length & 0xFF));
+    }
+
+    std::uint32_t readFrameHeader(const char* data)
+    {
+        const auto* bytes = reinterpret_cast<const unsigned char*>(data);
+        return (std::uint32_t{bytes[0]} << 24) | (std::uint32_t{bytes[1]} << 16) | (std::uint32_t{bytes[2]} << 8) | std::uint32_t{bytes[3]};
+    }
+
+    const std::size_t FrameHeaderSize = 4;
+
+    // Maximum amount of bytes read in one go, so that sending isn't delayed while a lot of data is arriving
+    const std::size_t MaxBytesPerReceive = 64 * 1024;
+}
+
+
+ChatSession::ChatSession() = default;
+
+
+ChatSession::~ChatSession()
+{
+    disconnect();
+}
+
+
+void ChatSession::connect(const sf::IpAddress& address, unsigned short port)
+{
+    disconnect();
+
+    // The I/O thread isn't running, so the buffers and the outgoing queue can safely be reset from this thread
+    std::string message;
+    while (m_outgoingMessages.pop(message))
+        ;
+
+    m_receiveBuffer.clear();
+    m_sendBuffer.clear();
+    m_sendOffset = 0;
+
+    m_stopRequested = false;
+    m_state = State::Connecting;
+    m_thread = std::thread(&ChatSession::run, this, address, port);
+}
+
+
+void ChatSession::disconnect()
+{
+    m_stopRequested = true;
+    if (m_thread.joinable())
+        m_thread.join();
+
+    // A failed connection keeps its state, so that the reason why the session ended remains visible
+    if ((m_state == State::Connecting) || (m_state == State::Connected))
+        m_state = State::Disconnected;
+}
+
+
+bool ChatSession::send(std::string message)
+{
+    if ((m_state != State::Connected) || (message.size() > MaxMessageSize))
+        return false;
+
+    return m_outgoingMessages.push(std::move(message));
+}
+
+
+bool ChatSession::pollMessage(std::string& message)
+{
+    return m_incomingMessages.pop(message);
+}
+
+
+ChatSession::State ChatSession::getState() const
+{
+    return m_state;
+}
+
+
+void ChatSession::run(sf::IpAddress address, unsigned short port)
+{
+    // Connecting is the only blocking operation, which is why it is limited by a timeout
+    sf::TcpSocket socket;
+    if (socket.connect(address, port, sf::seconds(5)) != sf::Socket::Done)
+    {
+        m_state = State::Failed;
+        return;
+    }
+
+    socket.setBlocking(false);
+    m_closedState = State::Connected;
+    m_state = State::Connected;
+
+    sf::SocketSelector selector;
+    selector.add(socket);
+
+    std::deque<std::string> pendingMessages;
+    while (!m_stopRequested)
+    {
+        // Decoded messages wait here while the GUI thread is lagging behind, no new data is read until they are handed over
+        while (!pendingMessages.empty() && m_incomingMessages.push(std::move(pendingMessages.front())))
+            pendingMessages.pop_front();
+
+        if (pendingMessages.empty() && !receiveData(socket, pendingMessages))
+            break;
+
+        if (!sendData(socket))
+            break;
+
+        // Sleep until data arrives, but wake up regularly to send new messages and to check whether we have to stop
+        const bool sending = (m_sendOffset < m_sendBuffer.size()) || !m_outgoingMessages.empty();
+        if (!pendingMessages.empty() || sending)
+            sf::sleep(sf::milliseconds(1));
+        else
+            selector.wait(sf::milliseconds(5));
+    }
+
+    socket.disconnect();
+
+    // The messages that arrived before the connection was closed are still delivered
+    while (!pendingMessages.empty() && !m_stopRequested)
+    {
+        if (m_incomingMessages.push(std::move(pendingMessages.front())))
+            pendingMessages.pop_front();
+        else
+            sf::sleep(sf::milliseconds(1));
+    }
+
+    if (m_closedState != State::Connected)
+        m_state = m_closedState;
+}
+
+
+bool ChatSession::receiveData(sf::TcpSocket& socket, std::deque<std::string>& messages)
+{
+    char buffer[4096];
+    std::size_t totalReceived = 0;
+    while (totalReceived < MaxBytesPerReceive)
+    {
+        std::size_t received = 0;
+        const sf::Socket::Status status = socket.receive(buffer, sizeof(buffer), received);
+        if (status == sf::Socket::NotReady)
+            break;
+
+        // The frames that were already received are still decoded when the connection is closed
+        if ((status == sf::Socket::Disconnected) || (status == sf::Socket::Error))
+        {
+            m_closedState = (status == sf::Socket::Disconnected) ? State::Disconnected : State::Failed;
+            break;
+        }
+
+        m_receiveBuffer.append(buffer, received);
+        totalReceived += received;
+    }
+
+    std::size_t offset = 0;
+    while (m_receiveBuffer.size() - offset >= FrameHeaderSize)
+    {
+        const std::uint32_t length = readFrameHeader(m_receiveBuffer.data() + offset);
+        if (length > MaxMessageSize)
+        {
+            // The stream can't be trusted anymore when the other side doesn't follow the protocol
+            m_closedState = State::Failed;
+            break;
+        }
+
+        if (m_receiveBuffer.size() - offset - FrameHeaderSize < length)
+            break;
+
+        messages.push_back(m_receiveBuffer.substr(offset + FrameHeaderSize, length));
+        offset += FrameHeaderSize + length;
+    }
+
+    m_receiveBuffer.erase(0, offset);
+    return m_closedState == State::Connected;
+}
+
+
+bool ChatSession::sendData(sf::TcpSocket& socket)
+{
+    if (m_sendOffset == m_sendBuffer.size())
+    {
+        m_sendBuffer.clear();
+        m_sendOffset = 0;
+    }
+
+    std::string message;
+    while (m_outgoingMessages.pop(message))
+    {
+        appendFrameHeader(m_sendBuffer, static_cast<std::uint32_t>(message.size()));
+        m_sendBuffer += message;
+    }
+
+    while (m_sendOffset < m_sendBuffer.size())
+    {
+        std::size_t sent = 0;
+        const sf::Socket::Status status = socket.send(m_sendBuffer.data() + m_sendOffset, m_sendBuffer.size() - m_sendOffset, sent);
+        m_sendOffset += sent;
+
+        if ((status == sf::Socket::NotReady) || (status == sf::Socket::Partial))
+            break;
+
+        if ((status == sf::Socket::Disconnected) || (status == sf::Socket::Error))
+        {
+            m_closedState = (status == sf::Socket::Disconnected) ? State::Disconnected : State::Failed;
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,81 @@
+#ifndef SFMLCHAT_CHAT_SESSION_HPP
+#define SFMLCHAT_CHAT_SESSION_HPP
+
+#include "SpscQueue.hpp"
+
+#include <SFML/Network.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <thread>
+
+
+// Connection to the chat server that runs on its own I/O thread.
+//
+// Every message on the wire is a 4-byte big-endian length followed by that many bytes of UTF-8 text.
+// The GUI thread exchanges messages with the I/O thread through lock-free queues, so none of the functions
+// called from the GUI thread ever wait for the network.
+class ChatSession
+{
+public:
+
+    enum class State
+    {
+        Disconnected,
+        Connecting,
+        Connected,
+        Failed // The connection could not be made or was closed because of an error
+    };
+
+    static constexpr std::uint32_t MaxMessageSize = 1024 * 1024;
+
+    ChatSession();
+    ~ChatSession();
+
+    ChatSession(const ChatSession&) = delete;
+    ChatSession& operator=(const ChatSession&) = delete;
+
+    // Starts connecting on the I/O thread, an existing connection is closed first
+    void connect(const sf::IpAddress& address, unsigned short port);
+
+    // Closes the connection and waits for the I/O thread to finish
+    void disconnect();
+
+    // Queues a message to be sent. Returns false when not connected, when the message is too large or when the
+    // outgoing queue is full.
+    bool send(std::string message);
+
+    // Takes the oldest received message. Returns false when no message has arrived since the last call.
+    bool pollMessage(std::string& message);
+
+    State getState() const;
+
+private:
+
+    void run(sf::IpAddress address, unsigned short port);
+
+    // Reads what is available on the socket and decodes the complete frames. Returns false when the connection was closed.
+    bool receiveData(sf::TcpSocket& socket, std::deque<std::string>& messages);
+
+    // Writes as much of the queued outgoing data as the socket accepts. Returns false when the connection was closed.
+    bool sendData(sf::TcpSocket& socket);
+
+private:
+
+    SpscQueue<std::string> m_incomingMessages{4096};
+    SpscQueue<std::string> m_outgoingMessages{1024};
+
+    std::atomic<State> m_state{State::Disconnected};
+    std::atomic<bool> m_stopRequested{false};
+    std::thread m_thread;
+
+    // Only used by the I/O thread
+    State m_closedState = State::Connected; // State to switch to once the received messages have been handed over
+    std::string m_receiveBuffer;
+    std::string m_sendBuffer;
+    std::size_t m_sendOffset = 0;
+};
+
+#endif // SFMLCHAT_CHAT_SESSION_HPP
@@ -0,0 +1,63 @@
+#include "EchoServer.hpp"
+
+#include <SFML/Network.hpp>
+
+#include <iostream>
+#include <list>
+#include <memory>
+
+
+int runEchoServer(unsigned short port)
+{
+    sf::TcpListener listener;
+    if (listener.listen(port, sf::IpAddress::LocalHost) != sf::Socket::Done)
+    {
+        std::cerr << "Failed to listen on port " << port << std::endl;
+        return 1;
+    }
+
+    std::cout << "Echo server listening on " << sf::IpAddress::LocalHost.toString() << ":" << port << std::endl;
+
+    sf::SocketSelector selector;
+    selector.add(listener);
+
+    std::list<std::unique_ptr<sf::TcpSocket>> clients;
+    while (true)
+    {
+        if (!selector.wait())
+            continue;
+
+        if (selector.isReady(listener))
+        {
+            auto client = std::make_unique<sf::TcpSocket>();
+            if (listener.accept(*client) == sf::Socket::Done)
+            {
+                selector.add(*client);
+                clients.push_back(std::move(client));
+            }
+        }
+
+        for (auto it = clients.begin(); it != clients.end();)
+        {
+            sf::TcpSocket& client = **it;
+            if (!selector.isReady(client))
+            {
+                ++it;
+                continue;
+            }
+
+            char buffer[4096];
+            std::size_t received = 0;
+            if ((client.receive(buffer, sizeof(buffer), received) == sf::Socket::Done)
+             && (client.send(buffer, received) == sf::Socket::Done))
+            {
+                ++it;
+            }
+            else
+            {
+                selector.remove(client);
+                it = clients.erase(it);
+            }
+        }
+    }
+}
@@ -0,0 +1,10 @@
+#ifndef SFMLCHAT_ECHO_SERVER_HPP
+#define SFMLCHAT_ECHO_SERVER_HPP
+
+
+// Listens on the loopback interface and sends everything a client sends straight back to that client.
+// Since the bytes are returned unchanged, the framing of the chat protocol is preserved, which makes this
+// server useful for trying out the client without a real chat server. Only returns when listening fails.
+int runEchoServer(unsigned short port);
+
+#endif // SFMLCHAT_ECHO_SERVER_HPP
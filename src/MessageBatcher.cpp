@@ -0,0 +1,86 @@
+#include "MessageBatcher.hpp"
+
+#include <SFML/System/Sleep.hpp>
+
+#include <iterator>
+
+
+MessageBatcher::MessageBatcher(ChatSession& session) :
+    m_session{session}
+{
+}
+
+
+MessageBatcher::~MessageBatcher()
+{
+    stop();
+}
+
+
+void MessageBatcher::start()
+{
+    stop();
+
+    m_stopRequested = false;
+    m_thread = std::thread(&MessageBatcher::run, this);
+}
+
+
+void MessageBatcher::stop()
+{
+    m_stopRequested = true;
+    if (m_thread.joinable())
+        m_thread.join();
+}
+
+
+bool MessageBatcher::takeMessages(std::vector<sf::String>& messages)
+{
+    const std::size_t oldSize = messages.size();
+
+    std::vector<sf::String> batch;
+    while (m_batches.pop(batch))
+    {
+        if (messages.empty())
+            messages = std::move(batch);
+        else
+            messages.insert(messages.end(), std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+    }
+
+    // Messages that didn't fit in the queue when the worker stopped come after the queued ones
+    if (!m_thread.joinable() && !m_unqueuedMessages.empty())
+    {
+        messages.insert(messages.end(), std::make_move_iterator(m_unqueuedMessages.begin()), std::make_move_iterator(m_unqueuedMessages.end()));
+        m_unqueuedMessages.clear();
+    }
+
+    return messages.size() > oldSize;
+}
+
+
+void MessageBatcher::run()
+{
+    std::vector<sf::String> batch;
+    std::string message;
+    while (!m_stopRequested)
+    {
+        // Everything that is available is decoded in one go. When the GUI thread hasn't taken the previous batches yet
+        // and the queue is full, the messages keep being added to the current batch.
+        bool received = false;
+        while (m_session.pollMessage(message))
+        {
+            batch.push_back(sf::String::fromUtf8(message.begin(), message.end()));
+            received = true;
+        }
+
+        if (!batch.empty() && m_batches.push(std::move(batch)))
+            batch.clear();
+
+        if (!received)
+            sf::sleep(sf::milliseconds(1));
+    }
+
+    // The GUI thread is waiting for this thread to finish, so the last batch is kept aside when the queue is full
+    if (!batch.empty() && !m_batches.push(std::move(batch)))
+        m_unqueuedMessages = std::move(batch);
+}
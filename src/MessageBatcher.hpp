@@ -0,0 +1,58 @@
+#ifndef SFMLCHAT_MESSAGE_BATCHER_HPP
+#define SFMLCHAT_MESSAGE_BATCHER_HPP
+
+#include "ChatSession.hpp"
+#include "SpscQueue.hpp"
+
+#include <SFML/System/String.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+
+// Ingestion stage between the chat session and the GUI.
+//
+// A worker thread takes the messages from the session, decodes them and groups them into batches. The GUI thread
+// collects everything that arrived since the previous frame with a single call, so that a burst of messages (e.g. the
+// backlog that the server replays after reconnecting) can be added to a ChatBox with one addLines call.
+//
+// While the batcher is running, it is the only consumer of the messages of the session, so pollMessage may not be
+// called on the session from anywhere else.
+class MessageBatcher
+{
+public:
+
+    explicit MessageBatcher(ChatSession& session);
+    ~MessageBatcher();
+
+    MessageBatcher(const MessageBatcher&) = delete;
+    MessageBatcher& operator=(const MessageBatcher&) = delete;
+
+    // Starts the worker thread
+    void start();
+
+    // Stops the worker thread, messages that were already decoded can still be taken afterwards
+    void stop();
+
+    // Appends all messages that were decoded since the last call. Returns false when there were no new messages.
+    bool takeMessages(std::vector<sf::String>& messages);
+
+private:
+
+    void run();
+
+private:
+
+    ChatSession& m_session;
+
+    SpscQueue<std::vector<sf::String>> m_batches{256};
+
+    std::atomic<bool> m_stopRequested{false};
+    std::thread m_thread;
+
+    // Only accessed by the worker while it is stopping and by the GUI thread once the worker has finished
+    std::vector<sf::String> m_unqueuedMessages;
+};
+
+#endif // SFMLCHAT_MESSAGE_BATCHER_HPP
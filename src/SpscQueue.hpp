@@ -0,0 +1,72 @@
+#ifndef SFMLCHAT_SPSC_QUEUE_HPP
+#define SFMLCHAT_SPSC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+
+// Bounded queue that hands values from exactly one producer thread to exactly one consumer thread without locking.
+// Neither side ever waits: push fails when the queue is full and pop fails when it is empty.
+template <typename T>
+class SpscQueue
+{
+public:
+
+    // The capacity is rounded up to a power of two
+    explicit SpscQueue(std::size_t capacity)
+    {
+        std::size_t size = 1;
+        while (size < capacity)
+            size *= 2;
+
+        m_items = std::make_unique<T[]>(size);
+        m_mask = size - 1;
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // May only be called from the producer thread. Returns false without moving the value when the queue is full.
+    bool push(T&& value)
+    {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_head.load(std::memory_order_acquire) > m_mask)
+            return false;
+
+        m_items[tail & m_mask] = std::move(value);
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // May only be called from the consumer thread. Returns false when there is nothing in the queue.
+    bool pop(T& value)
+    {
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire))
+            return false;
+
+        value = std::move(m_items[head & m_mask]);
+        m_items[head & m_mask] = T{};
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Only an estimate when called while the other thread is using the queue
+    bool empty() const
+    {
+        return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+    }
+
+private:
+
+    std::unique_ptr<T[]> m_items;
+    std::size_t m_mask = 0;
+
+    // Both indices only increase, they are kept on separate cache lines so that both threads don't keep invalidating each other
+    alignas(64) std::atomic<std::size_t> m_head{0}; // Next item to pop, only written by the consumer
+    alignas(64) std::atomic<std::size_t> m_tail{0}; // Next item to push, only written by the producer
+};
+
+#endif // SFMLCHAT_SPSC_QUEUE_HPP
@@ -3,11 +3,126 @@
 //
 
 #include <TGUI/TGUI.hpp>
+#include <SFML/System/Sleep.hpp>
 
+#include "ChatSession.hpp"
+#include "EchoServer.hpp"
+#include "MessageBatcher.hpp"
 
-int main()
+#include <cstdlib>
+#include <string>
+
+
+namespace
 {
+    const unsigned short DefaultPort = 53000;
+
+    void showState(tgui::ChatBox& chatBox, ChatSession::State state)
+    {
+        switch (state)
+        {
+            case ChatSession::State::Connecting:
+                chatBox.addLine("Connecting...", sf::Color(128, 128, 128));
+                break;
+            case ChatSession::State::Connected:
+                chatBox.addLine("Connected", sf::Color(128, 128, 128));
+                break;
+            case ChatSession::State::Disconnected:
+                chatBox.addLine("Disconnected", sf::Color(128, 128, 128));
+                break;
+            case ChatSession::State::Failed:
+                chatBox.addLine("Connection failed", sf::Color::Red);
+                break;
+        }
+    }
+}
+
+
+// Usage: sfmlchat-client [host] [port]
+//        sfmlchat-client --echo-server [port]
+int main(int argc, char* argv[])
+{
+    if ((argc > 1) && (std::string(argv[1]) == "--echo-server"))
+        return runEchoServer((argc > 2) ? static_cast<unsigned short>(std::atoi(argv[2])) : DefaultPort);
+
+    const sf::IpAddress address = (argc > 1) ? sf::IpAddress(argv[1]) : sf::IpAddress::LocalHost;
+    const unsigned short port = (argc > 2) ? static_cast<unsigned short>(std::atoi(argv[2])) : DefaultPort;
+
+    sf::RenderWindow window(sf::VideoMode(800, 600), "sfmlchat");
+    window.setFramerateLimit(60);
+
+    tgui::Gui gui(window);
+
+    auto chatBox = tgui::ChatBox::create();
+    chatBox->setPosition(10, 10);
+    chatBox->setSize("100% - 20", "100% - 60");
+    gui.add(chatBox);
+
+    auto editBox = tgui::EditBox::create();
+    editBox->setPosition(10, "100% - 40");
+    editBox->setSize("100% - 20", 30);
+    editBox->setDefaultText("Type a message and press enter");
+    gui.add(editBox);
+
+    ChatSession session;
+    session.connect(address, port);
+
+    MessageBatcher batcher(session);
+    batcher.start();
+
+    editBox->connect("ReturnKeyPressed", [&](const sf::String& text){
+        if (text.isEmpty())
+            return;
+
+        const auto utf8 = text.toUtf8();
+        if (session.send(std::string(utf8.begin(), utf8.end())))
+            editBox->setText("");
+    });
+
+    ChatSession::State lastState = session.getState();
+    showState(*chatBox, lastState);
+
+    std::vector<sf::String> newMessages;
+    while (window.isOpen())
+    {
+        sf::Event event;
+        while (window.pollEvent(event))
+        {
+            if (event.type == sf::Event::Closed)
+                window.close();
+            else if (event.type == sf::Event::Resized)
+                window.setView(sf::View(sf::FloatRect(0, 0, static_cast<float>(event.size.width), static_cast<float>(event.size.height))));
+
+            gui.handleEvent(event);
+        }
+
+        // All messages that arrived since the previous frame are added at once, which only updates the scrollbar once.
+        // This only takes what was already decoded and never waits for the network.
+        if (batcher.takeMessages(newMessages))
+        {
+            chatBox->addLines(newMessages);
+            newMessages.clear();
+        }
+
+        const ChatSession::State state = session.getState();
+        if (state != lastState)
+        {
+            showState(*chatBox, state);
+            lastState = state;
+        }
 
+        // Nothing is drawn while the gui doesn't change, the window keeps showing the previous frame
+        if (gui.needsRedraw())
+        {
+            window.clear(sf::Color::White);
+            gui.draw();
+            window.display();
+        }
+        else
+            sf::sleep(sf::milliseconds(10));
+    }
 
+    batcher.stop();
+    session.disconnect();
     return 0;
 }